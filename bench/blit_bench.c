@@ -0,0 +1,169 @@
+/*
+ * X-Tech Launcher - a simple template game launcher
+ *
+ * Copyright (c) 2009-2011 Andrew Spinks, original VB6 code
+ * Copyright (c) 2020-2020 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Per-frame blit cost of the menu images on the CPU: the colour-keyed
+ * RLE surfaces the launcher keeps, against the 32-bit RGBA copies that
+ * were alpha-blended before. Images are read from ../res, run it from
+ * the bench directory.
+ */
+
+#include <stdio.h>
+#include <SDL2/SDL.h>
+
+#define FRAMES      2000
+#define TEXT_GLYPHS 48
+
+/* The keyed image expanded into 32-bit RGBA the way the old loader did */
+static SDL_Surface *expandKeyed(SDL_Surface *src)
+{
+    SDL_Surface *rgba;
+    Uint32 rmask, gmask, bmask, amask;
+
+#if SDL_BYTEORDER != SDL_BIG_ENDIAN
+    rmask = 0xff000000;
+    gmask = 0x00ff0000;
+    bmask = 0x0000ff00;
+    amask = 0x000000ff;
+#else
+    rmask = 0x000000ff;
+    gmask = 0x0000ff00;
+    bmask = 0x00ff0000;
+    amask = 0xff000000;
+#endif
+
+    rgba = SDL_CreateRGBSurface(SDL_SWSURFACE, src->w, src->h, 32, rmask, gmask, bmask, amask);
+    if(rgba)
+        SDL_BlitSurface(src, NULL, rgba, NULL);
+
+    return rgba;
+}
+
+static SDL_Surface *loadKeyed(const char *path, int rle)
+{
+    SDL_Surface *s = SDL_LoadBMP(path);
+
+    if(!s)
+    {
+        fprintf(stderr, "Can't load %s: %s\n", path, SDL_GetError());
+        return NULL;
+    }
+
+    SDL_SetColorKey(s, SDL_TRUE, SDL_MapRGB(s->format, 255, 0, 255));
+    SDL_SetSurfaceRLE(s, rle);
+
+    return s;
+}
+
+/* One menu frame: background, splash and three lines of text */
+static void drawFrame(SDL_Surface *frame, SDL_Surface *back, SDL_Surface *splash, SDL_Surface *font)
+{
+    SDL_Rect src, dst;
+    int i;
+
+    SDL_BlitSurface(back, NULL, frame, NULL);
+
+    dst.x = 50;
+    dst.y = 80;
+    SDL_BlitSurface(splash, NULL, frame, &dst);
+
+    src.w = 18;
+    src.h = 16;
+    for(i = 0; i < TEXT_GLYPHS; i++)
+    {
+        src.x = 2;
+        src.y = ((i * 7) % 94) * 32;
+        dst.x = 200 + (i % 16) * 18;
+        dst.y = 300 + (i / 16) * 32;
+        SDL_BlitSurface(font, &src, frame, &dst);
+    }
+}
+
+static double timeFrames(const char *name, SDL_Surface *frame,
+                         SDL_Surface *back, SDL_Surface *splash, SDL_Surface *font)
+{
+    Uint64 begin, end;
+    double usec;
+    int i;
+
+    /* The first blit encodes RLE surfaces, keep it out of the timing */
+    drawFrame(frame, back, splash, font);
+
+    begin = SDL_GetPerformanceCounter();
+    for(i = 0; i < FRAMES; i++)
+        drawFrame(frame, back, splash, font);
+    end = SDL_GetPerformanceCounter();
+
+    usec = (double)(end - begin) * 1000000.0 / (double)SDL_GetPerformanceFrequency() / FRAMES;
+    printf("%-24s %8.1f us/frame\n", name, usec);
+
+    return usec;
+}
+
+int main(int argc, char *argv[])
+{
+    SDL_Surface *frame, *back;
+    SDL_Surface *splashRle, *fontRle, *splashKey, *fontKey, *splashRgba, *fontRgba;
+    double before, after;
+
+    (void)argc;
+    (void)argv;
+
+    if(SDL_Init(0) < 0)
+        return 1;
+
+    back = SDL_LoadBMP("../res/back.bmp");
+    splashRle = loadKeyed("../res/splash.bmp", 1);
+    fontRle = loadKeyed("../res/Font2_2.bmp", 1);
+    splashKey = loadKeyed("../res/splash.bmp", 0);
+    fontKey = loadKeyed("../res/Font2_2.bmp", 0);
+    if(!back || !splashRle || !fontRle || !splashKey || !fontKey)
+        return 1;
+
+    splashRgba = expandKeyed(splashKey);
+    fontRgba = expandKeyed(fontKey);
+    /* Same target format as the static layer */
+    frame = SDL_CreateRGBSurfaceWithFormat(0, back->w, back->h, 32, SDL_PIXELFORMAT_RGB888);
+    if(!splashRgba || !fontRgba || !frame)
+        return 1;
+
+    printf("%d frames of %dx%d, %d glyphs each\n", FRAMES, frame->w, frame->h, TEXT_GLYPHS);
+    before = timeFrames("RGBA alpha blend", frame, back, splashRgba, fontRgba);
+    timeFrames("colour key", frame, back, splashKey, fontKey);
+    after = timeFrames("colour key, RLE", frame, back, splashRle, fontRle);
+    printf("RLE speed-up over blending: %.2fx\n", before / after);
+
+    SDL_FreeSurface(frame);
+    SDL_FreeSurface(fontRgba);
+    SDL_FreeSurface(splashRgba);
+    SDL_FreeSurface(fontKey);
+    SDL_FreeSurface(splashKey);
+    SDL_FreeSurface(fontRle);
+    SDL_FreeSurface(splashRle);
+    SDL_FreeSurface(back);
+    SDL_Quit();
+
+    return 0;
+}
@@ -0,0 +1,8 @@
+#!/bin/bash
+
+# Standalone benchmarks, built against the system SDL2.
+# Run them from this directory, they read images from ../res
+SDL_FLAGS=$(pkg-config --cflags --libs sdl2) || exit 1
+
+cc -O2 -Wall -o blit_bench blit_bench.c $SDL_FLAGS || exit 1
+cc -O2 -Wall -I../src -o pixops_bench pixops_bench.c ../src/pixops.c $SDL_FLAGS || exit 1
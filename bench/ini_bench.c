@@ -0,0 +1,164 @@
+/*
+ * X-Tech Launcher - a simple template game launcher
+ *
+ * Copyright (c) 2009-2011 Andrew Spinks, original VB6 code
+ * Copyright (c) 2020-2020 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Load time and allocation count of ini_load on a large generated file.
+ * Built against both the current and an older lib/ini.c by ini_bench.sh.
+ *
+ * Usage: ini_bench -g file    generate the test file
+ *        ini_bench file [runs]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <SDL2/SDL.h>
+
+#include "ini.h"
+
+#define BENCH_KEYS          60000
+#define KEYS_PER_SECTION    50
+
+static SDL_malloc_func s_malloc;
+static SDL_calloc_func s_calloc;
+static SDL_realloc_func s_realloc;
+static SDL_free_func s_free;
+static long s_allocations = 0;
+
+static void *countMalloc(size_t size)
+{
+    s_allocations++;
+    return s_malloc(size);
+}
+
+static void *countCalloc(size_t n, size_t size)
+{
+    s_allocations++;
+    return s_calloc(n, size);
+}
+
+static void *countRealloc(void *p, size_t size)
+{
+    if(!p)
+        s_allocations++;
+    return s_realloc(p, size);
+}
+
+/* Sections of keys with values of pseudo-random length, plus the odd cases of the format */
+static int generate(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    unsigned long seed = 1;
+    int i, len;
+
+    if(!f)
+        return 1;
+
+    fprintf(f, "; Generated by ini_bench\n");
+    fprintf(f, "global-key = 1\r\n");
+    fprintf(f, "[ ]\n");
+    fprintf(f, "blank-section-key = 2\n");
+    fprintf(f, "continued = first \\\n    second\n");
+
+    for(i = 0; i < BENCH_KEYS; i++)
+    {
+        if(i % KEYS_PER_SECTION == 0)
+            fprintf(f, "\n[section%d]\n", i / KEYS_PER_SECTION);
+
+        seed = seed * 1103515245UL + 12345UL;
+        len = (int)((seed >> 16) % 120);
+        fprintf(f, "key%d = \"value %d %.*s\"\n", i, i, len,
+                "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"
+                "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx");
+    }
+
+    return fclose(f) == 0 ? 0 : 1;
+}
+
+static void lookup(ini_t *ini, char *section, char *name)
+{
+    char *value = NULL;
+
+    ini_read_str(ini, section, name, &value, "<missing>");
+    printf("  [%s] %s = %.32s\n", section ? section : "", name, value);
+    SDL_free(value);
+}
+
+int main(int argc, char *argv[])
+{
+    ini_t *ini;
+    Uint64 begin, time;
+    double best = 0.0, total = 0.0, ms;
+    long allocations = 0;
+    int i, runs;
+
+    if(argc == 3 && SDL_strcmp(argv[1], "-g") == 0)
+        return generate(argv[2]);
+
+    if(argc < 2)
+    {
+        fprintf(stderr, "Usage: %s -g file | file [runs]\n", argv[0]);
+        return 1;
+    }
+
+    runs = argc > 2 ? atoi(argv[2]) : 10;
+    if(runs < 1)
+        runs = 1;
+
+    SDL_GetMemoryFunctions(&s_malloc, &s_calloc, &s_realloc, &s_free);
+    SDL_SetMemoryFunctions(countMalloc, countCalloc, countRealloc, s_free);
+
+    for(i = 0; i < runs; i++)
+    {
+        s_allocations = 0;
+        begin = SDL_GetPerformanceCounter();
+        ini = ini_load(argv[1]);
+        time = SDL_GetPerformanceCounter() - begin;
+
+        if(!ini)
+        {
+            fprintf(stderr, "Can't load %s\n", argv[1]);
+            return 1;
+        }
+
+        ms = (double)time * 1000.0 / (double)SDL_GetPerformanceFrequency();
+        if(i == 0 || ms < best)
+            best = ms;
+        total += ms;
+        allocations = s_allocations;
+
+        if(i == runs - 1)
+        {
+            lookup(ini, NULL, "global-key");
+            lookup(ini, "section0", "key0");
+            lookup(ini, "section1199", "key59999");
+        }
+
+        ini_free(ini);
+    }
+
+    printf("ini_load: best %.2f ms, average %.2f ms, %ld allocations\n", best, total / runs, allocations);
+
+    return 0;
+}
@@ -0,0 +1,26 @@
+#!/bin/bash
+
+# ini_load of the current lib/ini.c against an older revision of it,
+# the initial one by default: ./ini_bench.sh [revision] [runs]
+OLD_REV=${1:-$(git rev-list --max-parents=0 HEAD | tail -n 1)}
+RUNS=${2:-10}
+SDL_FLAGS=$(pkg-config --cflags --libs sdl2) || exit 1
+
+OLD_DIR=$(mktemp -d) || exit 1
+trap 'rm -rf "$OLD_DIR"' EXIT
+
+git show "$OLD_REV:lib/ini.c" > "$OLD_DIR/ini.c" || exit 1
+git show "$OLD_REV:lib/ini.h" > "$OLD_DIR/ini.h" || exit 1
+
+cc -O2 -Wall -I../lib -o ini_bench ini_bench.c ../lib/ini.c $SDL_FLAGS || exit 1
+cc -O2 -Wall -I"$OLD_DIR" -o "$OLD_DIR/ini_bench" ini_bench.c "$OLD_DIR/ini.c" $SDL_FLAGS || exit 1
+
+./ini_bench -g ini_bench.ini || exit 1
+ls -l ini_bench.ini
+
+echo "== $OLD_REV"
+"$OLD_DIR/ini_bench" ini_bench.ini "$RUNS"
+echo "== current"
+./ini_bench ini_bench.ini "$RUNS"
+
+rm -f ini_bench.ini
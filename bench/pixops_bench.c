@@ -0,0 +1,160 @@
+/*
+ * X-Tech Launcher - a simple template game launcher
+ *
+ * Copyright (c) 2009-2011 Andrew Spinks, original VB6 code
+ * Copyright (c) 2020-2020 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Fade and tint kernels of src/pixops.c against the SDL paths they
+ * replace, at the launcher window size and at 4K:
+ *   fade: SDL_RenderFillRect of translucent black with the software
+ *         renderer, against fadeSurface
+ *   tint: SDL_BlitSurface with a colour modulation, against tintPixels32
+ *         on the blitted pixels in place
+ */
+
+#include <stdio.h>
+#include <SDL2/SDL.h>
+
+#include "pixops.h"
+
+/* Enough passes to take some tens of milliseconds at any size */
+#define PIXELS_PER_RUN  200000000
+
+static const char *s_kernels[] = {"scalar", "SSE2", "AVX2"};
+
+static double elapsedUs(Uint64 begin, int passes)
+{
+    return (double)(SDL_GetPerformanceCounter() - begin) * 1000000.0 /
+           (double)SDL_GetPerformanceFrequency() / passes;
+}
+
+static void fillPattern(SDL_Surface *s)
+{
+    Uint32 *p = (Uint32 *)s->pixels;
+    int i, n = s->pitch / 4 * s->h;
+
+    for(i = 0; i < n; i++)
+        p[i] = 0xFF000000u | ((Uint32)i * 2654435761u >> 8);
+}
+
+static void benchFade(SDL_Surface *frame, int passes)
+{
+    SDL_Renderer *renderer;
+    Uint64 begin;
+    size_t k;
+    int i;
+
+    renderer = SDL_CreateSoftwareRenderer(frame);
+    if(renderer)
+    {
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+        begin = SDL_GetPerformanceCounter();
+        for(i = 0; i < passes; i++)
+        {
+            SDL_SetRenderDrawColor(renderer, 0, 0, 0, (Uint8)(i & 0x7F));
+            SDL_RenderFillRect(renderer, NULL);
+        }
+        printf("  fade  %-8s %10.1f us\n", "SDL", elapsedUs(begin, passes));
+        SDL_DestroyRenderer(renderer);
+    }
+
+    for(k = 0; k < SDL_arraysize(s_kernels); k++)
+    {
+        if(usePixelKernels(s_kernels[k]) != 0)
+            continue;
+
+        fillPattern(frame);
+        begin = SDL_GetPerformanceCounter();
+        for(i = 0; i < passes; i++)
+            fadeSurface(frame, NULL, (Uint8)(255 - (i & 0x7F)));
+        printf("  fade  %-8s %10.1f us\n", s_kernels[k], elapsedUs(begin, passes));
+    }
+}
+
+static void benchTint(SDL_Surface *src, SDL_Surface *dst, int passes)
+{
+    Uint32 mul = SDL_MapRGBA(src->format, 128, 255, 255, 255);
+    Uint64 begin;
+    size_t k;
+    int i;
+
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+    SDL_SetSurfaceColorMod(src, 128, 255, 255);
+    begin = SDL_GetPerformanceCounter();
+    for(i = 0; i < passes; i++)
+        SDL_BlitSurface(src, NULL, dst, NULL);
+    printf("  tint  %-8s %10.1f us\n", "SDL", elapsedUs(begin, passes));
+    SDL_SetSurfaceColorMod(src, 255, 255, 255);
+
+    for(k = 0; k < SDL_arraysize(s_kernels); k++)
+    {
+        if(usePixelKernels(s_kernels[k]) != 0)
+            continue;
+
+        /* The key matches no pixel of the opaque pattern */
+        begin = SDL_GetPerformanceCounter();
+        for(i = 0; i < passes; i++)
+            tintPixels32(dst->pixels, dst->w, dst->h, dst->pitch, mul, 0);
+        printf("  tint  %-8s %10.1f us\n", s_kernels[k], elapsedUs(begin, passes));
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    static const int sizes[][2] = {{600, 432}, {3840, 2160}};
+    SDL_Surface *frame, *block;
+    size_t i;
+    int passes;
+
+    (void)argc;
+    (void)argv;
+
+    if(SDL_Init(0) < 0)
+        return 1;
+
+    initPixelKernels();
+    printf("Runtime choice: %s\n", pixelKernelsName());
+
+    for(i = 0; i < SDL_arraysize(sizes); i++)
+    {
+        frame = SDL_CreateRGBSurfaceWithFormat(0, sizes[i][0], sizes[i][1], 32, SDL_PIXELFORMAT_ARGB8888);
+        block = SDL_CreateRGBSurfaceWithFormat(0, sizes[i][0], sizes[i][1], 32, SDL_PIXELFORMAT_ARGB8888);
+        if(!frame || !block)
+            return 1;
+
+        fillPattern(frame);
+        fillPattern(block);
+        passes = SDL_max(10, PIXELS_PER_RUN / (sizes[i][0] * sizes[i][1]));
+
+        printf("%dx%d, %d passes, time per pass:\n", sizes[i][0], sizes[i][1], passes);
+        benchFade(frame, passes);
+        benchTint(block, frame, passes);
+
+        SDL_FreeSurface(block);
+        SDL_FreeSurface(frame);
+    }
+
+    SDL_Quit();
+
+    return 0;
+}
@@ -0,0 +1,24 @@
+#!/bin/bash
+
+# Cold start of launcher builds: binary size and time to the first frame
+# from the startup trace. Pass one or more builds to compare, e.g. before
+# and after a change:
+#   ./startup.sh ../build-old/xtech-launcher ../build-new/xtech-launcher
+# Page cache is dropped before every run when it's writable (as root),
+# otherwise the runs are warm. No display is needed.
+RUNS=${RUNS:-5}
+
+for bin in "$@"; do
+    echo "== $bin"
+    size "$bin" 2>/dev/null || ls -l "$bin"
+
+    for i in $(seq "$RUNS"); do
+        if [ -w /proc/sys/vm/drop_caches ]; then
+            sync
+            echo 3 > /proc/sys/vm/drop_caches
+        fi
+
+        # The launcher waits for input after the fade-in, stop it then
+        SDL_VIDEODRIVER=dummy timeout 3 "$bin" 2>&1 | grep -E "Startup: first frame|Image .* decoded"
+    done
+done
@@ -3,9 +3,25 @@
  *     History: yang@haipo.me, 2013/06/13, create
  */
 
+/* st_mtim is a POSIX 2008 field, hidden by -std=c90 */
+#if !defined(_WIN32) && !defined(__APPLE__) && !defined(_POSIX_C_SOURCE)
+#   define _POSIX_C_SOURCE 200809L
+#endif
+
 #include <ctype.h>
+#include <stdio.h>
 #include <SDL2/SDL.h>
 
+#ifdef _WIN32
+#   include <windows.h>
+#else
+#   include <sys/types.h>
+#   include <sys/stat.h>
+#   include <sys/mman.h>
+#   include <fcntl.h>
+#   include <unistd.h>
+#endif
+
 #include "ini.h"
 
 static const Uint8 utfbom[3] = {0xEF, 0xBB, 0xBF};
@@ -116,394 +132,1078 @@ static SDL_bool is_comment(char **line)
 }
 
 
-static Sint32 rw_getline(char **lineptr, size_t *n, SDL_RWops *stream)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#   define INI_SCAN_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#   include <arm_neon.h>
+#   define INI_SCAN_NEON
+#endif
+
+/* Splits a whole file held in memory into logical lines */
+struct ini_reader
 {
-    size_t nn = 0;
-    char c;
     char *cur;
-    *lineptr = SDL_malloc(2048);
-    cur = *lineptr;
+    char *end;
+    int   special_count;
+    char  special[8];
+#if defined(INI_SCAN_SSE2)
+    __m128i special_vec[8];
+#elif defined(INI_SCAN_NEON)
+    uint8x16_t special_vec[8];
+#endif
+};
 
-    do
+static void reader_init(struct ini_reader *r, char *data, size_t size)
+{
+    int c;
+
+    r->cur = data;
+    r->end = data + size;
+    r->special_count = 0;
+
+    /* The vector scanner compares against every char with the Special trait */
+    for(c = 0; c < 256 && r->special_count < (int)sizeof(r->special); ++c)
     {
-        if(SDL_RWread(stream, &c, 1, 1) < 1)
-        {
-            if(nn == 0)
-            {
-                SDL_free(*lineptr);
-                *lineptr = NULL;
-                return -1;
-            }
-            break;
-        }
-        if(c == '\r')
+        if(!IS_SPECIAL((char)c))
             continue;
-        if(c == '\n')
-            break;
-        nn++;
-        *cur = c;
-        cur++;
-    } while(nn < 2048);
-
-    *cur = '\0';
-    *n = nn;
+        r->special[r->special_count] = (char)c;
+#if defined(INI_SCAN_SSE2)
+        r->special_vec[r->special_count] = _mm_set1_epi8((char)c);
+#elif defined(INI_SCAN_NEON)
+        r->special_vec[r->special_count] = vdupq_n_u8((Uint8)c);
+#endif
+        r->special_count++;
+    }
 
-    return (Sint32)nn;
+    /* Try to skip UTF8 BOM */
+    if(size >= 3 && SDL_memcmp(data, utfbom, 3) == 0)
+        r->cur += 3;
 }
 
-static Sint32 _getline(char **lineptr, size_t *n, SDL_RWops *stream)
+/* Return pointer to the first Special char at or after p, or the end of data */
+static char *scan_special(const struct ini_reader *r, char *p)
 {
-    char *_line = NULL;
-    char *next_line;
-    Sint32 next_len;
-    Sint32 need_len;
-    size_t _n    = 0;
-    Sint32 len = rw_getline(lineptr, n, stream);
-
-    if(len == -1)
-        return -1;
+    int i;
 
-    while(len >= 2 && (*lineptr)[len - 2] == '\\')
+#if defined(INI_SCAN_SSE2)
+    while(r->end - p >= 16)
     {
-        if(rw_getline(&_line, &_n, stream) == -1)
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        __m128i hit = _mm_cmpeq_epi8(v, r->special_vec[0]);
+        int mask;
+
+        for(i = 1; i < r->special_count; ++i)
+            hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, r->special_vec[i]));
+
+        mask = _mm_movemask_epi8(hit);
+        if(mask != 0)
         {
-            SDL_free(_line);
-            return 0;
+            for(i = 0; !(mask & 1); ++i)
+                mask >>= 1;
+            return p + i;
         }
 
-        next_line = _line;
+        p += 16;
+    }
+#elif defined(INI_SCAN_NEON)
+    while(r->end - p >= 16)
+    {
+        uint8x16_t v = vld1q_u8((const Uint8 *)p);
+        uint8x16_t hit = vceqq_u8(v, r->special_vec[0]);
+
+        for(i = 1; i < r->special_count; ++i)
+            hit = vorrq_u8(hit, vceqq_u8(v, r->special_vec[i]));
 
-        while(SDL_isspace(*next_line))
-            ++next_line;
+        if(vmaxvq_u8(hit) != 0)
+            break; /* The scalar loop below locates it within this block */
 
-        next_len = (Sint32)SDL_strlen(next_line);
-        need_len = len - 1 + next_len + 1;
+        p += 16;
+    }
+#endif
+
+    (void)i;
+    while(p < r->end && !IS_SPECIAL(*p))
+        p++;
 
-        if((Sint32)*n < need_len)
+    return p;
+}
+
+/*
+ * Cut the next logical line out of the data, in place. A line ending
+ * with '\' is joined with the next one, LF and CR LF line ends are
+ * accepted. On return *delimiter points at the first '=' of the line,
+ * or is NULL. Return NULL when no data is left.
+ */
+static char *next_line(struct ini_reader *r, char **delimiter)
+{
+    char *line = r->cur;
+    char *seg = line;
+    char *out = NULL;
+    char *p = line;
+    char *e;
+
+    if(r->cur >= r->end)
+        return NULL;
+
+    *delimiter = NULL;
+
+    for(;;)
+    {
+        p = scan_special(r, p);
+
+        if(p < r->end && *p != '\n')
         {
-            while((Sint32)*n < need_len)
-                *n *= 2;
+            /* Positions past a joined line break are recomputed below */
+            if(*p == '=' && !*delimiter && !out)
+                *delimiter = p;
+            p++;
+            continue;
+        }
 
-            *lineptr = SDL_realloc(*lineptr, *n);
-            if(*lineptr == NULL)
-            {
-                SDL_free(_line);
+        r->cur = p < r->end ? p + 1 : p;
+        e = p;
+        if(e > seg && e[-1] == '\r')
+            e--;
 
-                return -1;
-            }
+        if(out)
+        {
+            SDL_memmove(out, seg, (size_t)(e - seg));
+            e = out + (e - seg);
         }
 
-        if(SDL_isspace((*lineptr)[len - 3]))
-            (*lineptr)[len - 2] = '\0';
+        if(e == line || e[-1] != '\\' || r->cur >= r->end)
+            break;
+
+        /* Continued line: drop the backslash and append the next line */
+        e--;
+        if(e > line && IS_SPACE(e[-1]))
+            out = e;
         else
-            (*lineptr)[len - 2] = ' ';
-        (*lineptr)[len - 1] = '\0';
+        {
+            *e = ' ';
+            out = e + 1;
+        }
 
-        strcat(*lineptr, next_line);
-        len = (Sint32)SDL_strlen(*lineptr);
+        seg = r->cur;
+        while(seg < r->end && (*seg == ' ' || *seg == '\t'))
+            seg++;
+        p = seg;
     }
 
-    if(_line)
-        SDL_free(_line);
+    *e = '\0';
 
-    return len;
+    if(out && !*delimiter)
+        *delimiter = SDL_strchr(line, '=');
+
+    return line;
 }
 
-void ini_free(ini_t *handler)
+/* Tell whether the data holds the whole next logical line */
+static SDL_bool line_complete(const struct ini_reader *r)
 {
-    struct ini_arg *arg_curr;
-    struct ini_arg *arg_next;
-    struct ini_section *curr = handler;
-    struct ini_section *next = NULL;
+    char *p = r->cur;
+    char *e;
 
-    while(curr)
+    for(;;)
     {
-        next = curr->next;
-
-        arg_curr = curr->args;
-        arg_next = NULL;
+        p = scan_special(r, p);
+        if(p >= r->end)
+            return SDL_FALSE;
 
-        while(arg_curr)
+        if(*p == '\n')
         {
-            arg_next = arg_curr->next;
+            e = p;
+            if(e > r->cur && e[-1] == '\r')
+                e--;
+            if(e == r->cur || e[-1] != '\\')
+                return SDL_TRUE;
+        }
 
-            SDL_free(arg_curr->name);
-            SDL_free(arg_curr->value);
-            SDL_free(arg_curr);
+        p++;
+    }
+}
 
-            arg_curr = arg_next;
-        }
+enum { LineNone, LineSection, LineArg };
+
+/*
+ * Classify a logical line. For a section header *name gets the section
+ * name, for a property *name and *value get the trimmed name and value.
+ * Both are terminated in place.
+ */
+static int split_line(char *line, char *delimiter, char **name, size_t *name_len, char **value)
+{
+    char *s = line;
+    char *name_end;
+    size_t len;
+
+    if(is_comment(&s))
+        return LineNone;
+
+    len = SDL_strlen(s);
+
+    if(len >= 3 && s[0] == '[' && s[len - 1] == ']')
+    {
+        *name = s + 1;
+        while(SDL_isspace(**name))
+            ++*name;
 
-        SDL_free(curr->name);
-        SDL_free(curr);
+        name_end = s + len - 1;
+        *name_end-- = '\0';
+        while(name_end >= *name && SDL_isspace(*name_end))
+            *name_end-- = '\0';
 
-        curr = next;
+        /* A blank name like "[ ]" leaves *name past the trimmed end */
+        *name_len = name_end < *name ? 0 : (size_t)(name_end + 1 - *name);
+        return LineSection;
     }
 
-    return;
+    if(delimiter == NULL)
+        return LineNone;
+    *delimiter = '\0';
+
+    *name = s;
+    name_end = delimiter - 1;
+    while(name_end >= s && SDL_isspace(*name_end))
+        *name_end-- = '\0';
+    *name_len = (size_t)(name_end + 1 - s);
+
+    *value = delimiter + 1;
+    while(SDL_isspace(**value))
+        ++*value;
+
+    return LineArg;
+}
+
+static void unmap_file(void *data, size_t size);
+
+void ini_free(ini_t *handler)
+{
+    if(handler && handler->mapping)
+        unmap_file(handler->mapping, handler->mapping_size);
+    SDL_free(handler);
 }
 
 static void ini_print(ini_t *handler)
 {
-    (void)handler;
 # ifdef DEBUG
-    struct ini_section *curr = handler;
+    Sint32 i, j;
 
-    while(curr)
+    for(i = 0; i < handler->sections_count; ++i)
     {
-        if(curr->name == NULL)
-            continue;
-
-        printf("[%s]\n", curr->name);
-
-        struct ini_arg *arg = curr->args;
+        printf("[%s]\n", handler->text + handler->sections[i].name.offset);
 
-        while(arg)
+        for(j = handler->sections[i].args; j >= 0; j = handler->args[j].next)
         {
-            if(arg->name == NULL || arg->value == NULL)
-                continue;
-
-            printf("    %-20s = %s\n", arg->name, arg->value);
-            arg = arg->next;
+            printf("    %-20s = %s\n",
+                   handler->text + handler->args[j].name.offset,
+                   handler->text + handler->args[j].value.offset);
         }
-
-        curr = curr->next;
     }
+# else
+    (void)handler;
 # endif
-
-    return;
 }
 
-static struct ini_section *create_section(struct ini_section *head, char *name)
+static struct ini_view make_view(ini_t *handler, const char *s, size_t len)
 {
-    struct ini_section *p = SDL_calloc(1, sizeof(struct ini_section));
+    struct ini_view v;
+    v.offset = (Uint32)(s - handler->text);
+    v.length = (Uint32)len;
+    return v;
+}
 
-    if(p == NULL)
-    {
-        ini_free(head);
+/* ASCII case folding, names are compared and hashed case-insensitively */
+static Uint8 fold(char c)
+{
+    return (Uint8)((c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c);
+}
 
-        return NULL;
-    }
+static Uint32 fold_hash(const char *s, size_t len, Uint32 seed)
+{
+    Uint32 h = 2166136261u ^ seed;
+    size_t i;
 
-    if((p->name = SDL_strdup(name)) == NULL)
+    for(i = 0; i < len; ++i)
     {
-        ini_free(head);
-
-        return NULL;
+        h ^= fold(s[i]);
+        h *= 16777619u;
     }
 
-    return p;
+    return h;
 }
 
-static struct ini_section *find_section(struct ini_section *head, char *name)
+static SDL_bool view_equals(ini_t *handler, const struct ini_view *v, const char *s, size_t len)
 {
-    struct ini_section *curr = head;
+    const char *t = handler->text + v->offset;
+    size_t i;
 
-    while(curr)
-    {
-        if(curr->name && SDL_strcmp(curr->name, name) == 0)
-            return curr;
+    if(v->length != len)
+        return SDL_FALSE;
 
-        curr = curr->next;
+    for(i = 0; i < len; ++i)
+    {
+        if(fold(t[i]) != fold(s[i]))
+            return SDL_FALSE;
     }
 
-    return NULL;
+    return SDL_TRUE;
 }
 
-static struct ini_arg *create_arg(struct ini_section *head, char *name, char *value)
+/*
+ * Open addressing with linear probing. A slot holds a node index plus
+ * one, zero marks an empty slot. Return the slot of the matching node,
+ * or the empty slot where it belongs.
+ */
+static Uint32 *section_slot(ini_t *handler, const char *name, size_t len)
 {
-    struct ini_arg *p = SDL_calloc(1, sizeof(struct ini_arg));
+    Uint32 i = fold_hash(name, len, 0) & handler->slots_mask;
 
-    if(p == NULL)
-    {
-        ini_free(head);
-
-        return NULL;
-    }
+    while(handler->section_slots[i] != 0 &&
+          !view_equals(handler, &handler->sections[handler->section_slots[i] - 1].name, name, len))
+        i = (i + 1) & handler->slots_mask;
 
-    if((p->name = SDL_strdup(name)) == NULL)
-    {
-        ini_free(head);
+    return &handler->section_slots[i];
+}
 
-        return NULL;
-    }
+/* Args are keyed by their section index and their name */
+static Uint32 *arg_slot(ini_t *handler, Sint32 section, const char *name, size_t len)
+{
+    Uint32 i = fold_hash(name, len, (Uint32)section * 0x9E3779B9u) & handler->slots_mask;
 
-    if((p->value = SDL_strdup(value)) == NULL)
+    while(handler->arg_slots[i] != 0)
     {
-        ini_free(head);
-
-        return NULL;
+        struct ini_arg *arg = &handler->args[handler->arg_slots[i] - 1];
+        if(arg->section == section && view_equals(handler, &arg->name, name, len))
+            break;
+        i = (i + 1) & handler->slots_mask;
     }
 
-    return p;
+    return &handler->arg_slots[i];
 }
 
-static struct ini_arg *find_arg(struct ini_section *curr, char *name)
+static Sint32 create_section(ini_t *handler, struct ini_view name)
 {
-    struct ini_arg *arg = curr->args;
+    struct ini_section *p = &handler->sections[handler->sections_count];
 
-    while(arg)
-    {
-        if(arg->name && SDL_strcmp(arg->name, name) == 0)
-            return arg;
-        arg = arg->next;
-    }
+    p->name = name;
+    p->args = -1;
+    p->last_arg = -1;
 
-    return NULL;
+    return handler->sections_count++;
 }
 
-ini_t *ini_load(char *path)
+static Sint32 create_arg(ini_t *handler, Sint32 section, struct ini_view name, struct ini_view value)
 {
-    struct ini_section *head = NULL;
-    struct ini_section *prev = NULL;
-    struct ini_section *curr = NULL;
+    struct ini_section *curr = &handler->sections[section];
+    Sint32 i = handler->args_count++;
 
-    struct ini_arg *arg_curr = NULL;
-    struct ini_arg *arg_prev = NULL;
+    handler->args[i].name = name;
+    handler->args[i].value = value;
+    handler->args[i].section = section;
+    handler->args[i].next = -1;
 
-    char magic[4];
-    char *line  = NULL;
-    size_t   n  = 0;
-    Sint32 len = 0;
+    if(curr->last_arg >= 0)
+        handler->args[curr->last_arg].next = i;
+    else
+        curr->args = i;
+    curr->last_arg = i;
+
+    return i;
+}
+
+# define INI_ALIGN(n) (((n) + 7) & ~(size_t)7)
+
+static const char globalName[] = "global";
+
+ini_t *ini_load(char *path)
+{
+    ini_t *handler;
+    struct ini_reader reader;
+    SDL_RWops *fp;
+    Sint64 file_size;
+    size_t size, head_size, text_size, lines = 1;
+    size_t slots = 16, max_lines;
+    char *block, *grown, *text, *p;
+    char *line;
+    Sint32 curr = -1;
+    Uint32 *slot;
 
     char *delimiter;
     char *name;
-    char *name_end;
+    size_t name_len;
     char *value;
 
-    SDL_RWops *fp = SDL_RWFromFile(path, "r");
+    fp = SDL_RWFromFile(path, "rb");
     if(fp == NULL)
         return NULL;
 
-    /* Try to skip UTF8 BOM */
-    if(SDL_RWread(fp, magic, 1, 3) < 3)
-        SDL_RWseek(fp, 0, RW_SEEK_SET);
+    /* Views hold 32-bit offsets */
+    file_size = SDL_RWsize(fp);
+    if(file_size < 0 || file_size > 0x7FFFFFF0)
+    {
+        SDL_RWclose(fp);
+        return NULL;
+    }
 
-    if(SDL_memcmp(magic, utfbom, 3) != 0)
-        SDL_RWseek(fp, 0, RW_SEEK_SET); /* no BOM detected */
+    size = (size_t)file_size;
+    head_size = INI_ALIGN(sizeof(ini_t));
+    text_size = INI_ALIGN(size + 1 + sizeof(globalName));
 
-    while((len = _getline(&line, &n, fp)) != -1)
+    block = (char *)SDL_malloc(head_size + text_size);
+    if(block == NULL)
     {
-        char *s = line;
+        SDL_RWclose(fp);
+        return NULL;
+    }
 
-        if(is_comment(&s))
-            continue;
+    text = block + head_size;
+    if(size > 0 && SDL_RWread(fp, text, 1, size) != size)
+    {
+        SDL_free(block);
+        SDL_RWclose(fp);
+        return NULL;
+    }
+    SDL_RWclose(fp);
 
-        len = (Sint32)SDL_strlen(s);
+    text[size] = '\0';
+    SDL_memcpy(text + size + 1, globalName, sizeof(globalName));
 
-        if(len >= 3 && s[0] == '[' && s[len - 1] == ']')
-        {
-            char *name = s + 1;
-            while(SDL_isspace(*name))
-                ++name;
+    /* Each section and each arg takes a line at least, that bounds the node arrays */
+    reader_init(&reader, text, size);
+    for(p = reader.cur; (p = scan_special(&reader, p)) < reader.end; ++p)
+    {
+        if(*p == '\n')
+            lines++;
+    }
 
-            name_end = s + len - 1;
-            *name_end-- = '\0';
-            while(SDL_isspace(*name_end))
-                *name_end-- = '\0';
+    /*
+     * Keep the hash tables at most half full, so there are about
+     * 8 * (lines + 1) slots in both. The block must fit in a size_t,
+     * which a large file can exceed on 32-bit targets.
+     */
+    max_lines = (SIZE_MAX - head_size - text_size) /
+                (sizeof(struct ini_section) + sizeof(struct ini_arg) + 8 * sizeof(Uint32)) - 1;
+    if(lines > max_lines)
+    {
+        SDL_free(block);
+        return NULL;
+    }
 
-            if((curr = find_section(head, name)) == NULL)
-            {
-                if((curr = create_section(head, name)) == NULL)
-                {
-                    SDL_free(line);
+    while(slots < 2 * (lines + 1))
+        slots *= 2;
 
-                    return NULL;
-                }
+    grown = (char *)SDL_realloc(block, head_size + text_size +
+                                (lines + 1) * sizeof(struct ini_section) +
+                                lines * sizeof(struct ini_arg) +
+                                2 * slots * sizeof(Uint32));
+    if(grown == NULL)
+    {
+        SDL_free(block);
+        return NULL;
+    }
 
-                if(head == NULL)
-                    head = curr;
-                if(prev != NULL)
-                    prev->next = curr;
+    handler = (ini_t *)grown;
+    handler->text = grown + head_size;
+    handler->sections = (struct ini_section *)(handler->text + text_size);
+    handler->sections_count = 0;
+    handler->args = (struct ini_arg *)(handler->sections + lines + 1);
+    handler->args_count = 0;
+    handler->section_slots = (Uint32 *)(handler->args + lines);
+    handler->arg_slots = handler->section_slots + slots;
+    handler->slots_mask = (Uint32)(slots - 1);
+    SDL_memset(handler->section_slots, 0, 2 * slots * sizeof(Uint32));
+    handler->mapping = NULL;
+    handler->mapping_size = 0;
+
+    reader_init(&reader, handler->text, size);
+
+    while((line = next_line(&reader, &delimiter)) != NULL)
+    {
+        switch(split_line(line, delimiter, &name, &name_len, &value))
+        {
+        case LineSection:
+            slot = section_slot(handler, name, name_len);
+            if(*slot == 0)
+                *slot = (Uint32)create_section(handler, make_view(handler, name, name_len)) + 1;
+            curr = (Sint32)*slot - 1;
+            break;
 
-                prev = curr;
-                arg_prev = NULL;
+        case LineArg:
+            if(curr < 0)
+            {
+                slot = section_slot(handler, globalName, sizeof(globalName) - 1);
+                if(*slot == 0)
+                    *slot = (Uint32)create_section(handler, make_view(handler, handler->text + size + 1, sizeof(globalName) - 1)) + 1;
+                curr = (Sint32)*slot - 1;
             }
-            else
+
+            slot = arg_slot(handler, curr, name, name_len);
+            if(*slot == 0)
             {
-                arg_prev = curr->args;
-                while(arg_prev->next != NULL)
-                    arg_prev = arg_prev->next;
+                *slot = (Uint32)create_arg(handler, curr,
+                                           make_view(handler, name, name_len),
+                                           make_view(handler, value, SDL_strlen(value))) + 1;
             }
+            else
+                handler->args[*slot - 1].value = make_view(handler, value, SDL_strlen(value));
+            break;
 
-            continue;
+        default:
+            break;
         }
+    }
 
-        delimiter = strchr(s, '=');
-        if(delimiter == NULL)
-            continue;
-        *delimiter = '\0';
+    ini_print(handler);
 
-        name = s;
-        name_end = delimiter - 1;
-        while(SDL_isspace(*name_end))
-            *name_end-- = '\0';
+    return handler;
+}
 
-        value = delimiter + 1;
-        while(SDL_isspace(*value))
-            value++;
+# define INI_STREAM_CHUNK 65536
 
-        if(curr == NULL)
+int ini_parse_stream(SDL_RWops *stream, ini_handler handler, void *userdata)
+{
+    struct ini_reader reader;
+    char *buf, *grown;
+    char *section = NULL;
+    size_t section_size = 0;
+    size_t cap = INI_STREAM_CHUNK;
+    size_t tail = 0;
+    size_t got;
+    SDL_bool first = SDL_TRUE;
+    SDL_bool eof = SDL_FALSE;
+    int ret = 0;
+
+    char *line;
+    char *delimiter;
+    char *name;
+    size_t name_len;
+    char *value;
+
+    if(stream == NULL || handler == NULL)
+        return -1;
+
+    buf = (char *)SDL_malloc(cap + 1);
+    if(buf == NULL)
+        return -1;
+
+    while(!eof && ret == 0)
+    {
+        /* A line longer than the buffer makes it grow */
+        if(tail == cap)
         {
-            if((curr = create_section(head, "global")) == NULL)
+            grown = (char *)SDL_realloc(buf, cap * 2 + 1);
+            if(grown == NULL)
             {
-                SDL_free(line);
-                return NULL;
+                ret = -1;
+                break;
             }
+            buf = grown;
+            cap *= 2;
+        }
 
-            if(head == NULL)
-                head = curr;
-            prev = curr;
-            arg_prev = NULL;
+        got = SDL_RWread(stream, buf + tail, 1, cap - tail);
+        if(got == 0)
+            eof = SDL_TRUE;
+        buf[tail + got] = '\0';
+
+        if(first)
+        {
+            reader_init(&reader, buf, tail + got);
+            first = SDL_FALSE;
+        }
+        else
+        {
+            reader.cur = buf;
+            reader.end = buf + tail + got;
         }
 
-        if((arg_curr = find_arg(curr, name)) == NULL)
+        /* Without the end of the stream only complete lines are taken */
+        while(ret == 0 && (eof || line_complete(&reader)) &&
+              (line = next_line(&reader, &delimiter)) != NULL)
         {
-            arg_curr = create_arg(head, name, value);
-            if(arg_curr == NULL)
+            switch(split_line(line, delimiter, &name, &name_len, &value))
             {
-                SDL_free(line);
+            case LineSection:
+                if(section_size <= name_len)
+                {
+                    grown = (char *)SDL_realloc(section, name_len + 1);
+                    if(grown == NULL)
+                    {
+                        ret = -1;
+                        break;
+                    }
+                    section = grown;
+                    section_size = name_len + 1;
+                }
+                SDL_memcpy(section, name, name_len + 1);
+                break;
+
+            case LineArg:
+                value = removeQuotes(value, value + SDL_strlen(value));
+                if(handler(userdata, section ? section : globalName, name, value) != 0)
+                    ret = 1;
+                break;
 
-                return NULL;
+            default:
+                break;
             }
+        }
+
+        /* Keep the unparsed rest for the next read */
+        tail = (size_t)(reader.end - reader.cur);
+        SDL_memmove(buf, reader.cur, tail);
+    }
 
-            if(arg_prev)
-                arg_prev->next = arg_curr;
-            if(curr->args == NULL)
-                curr->args = arg_curr;
+    SDL_free(section);
+    SDL_free(buf);
+
+    return ret;
+}
+
+/*
+ * Binary cache image: the header, then the string table, the section
+ * and arg arrays and both hash tables, laid out as in a loaded file.
+ * It is mapped read-only and used as is.
+ */
+# define INI_CACHE_MAGIC    0x32434958 /* "XIC2" */
+# define INI_CACHE_SUFFIX   ".cache"
+
+struct ini_cache_header
+{
+    Uint32 magic;
+    Uint32 header_size;
+    Uint64 source_size;
+    Sint64 source_mtime;
+    Uint32 text_size;
+    Sint32 sections_count;
+    Sint32 args_count;
+    Uint32 slots;
+};
+
+#ifdef _WIN32
+/* Paths are UTF-8, the ANSI calls would read them in the local code page */
+static WCHAR *wide_path(const char *path)
+{
+    WCHAR *wpath;
+    int len = MultiByteToWideChar(CP_UTF8, 0, path, -1, NULL, 0);
 
-            arg_prev = arg_curr;
+    if(len <= 0)
+        return NULL;
+
+    wpath = (WCHAR *)SDL_malloc((size_t)len * sizeof(WCHAR));
+    if(wpath != NULL && MultiByteToWideChar(CP_UTF8, 0, path, -1, wpath, len) != len)
+    {
+        SDL_free(wpath);
+        wpath = NULL;
+    }
+
+    return wpath;
+}
+
+static int file_stamp(const char *path, Uint64 *size, Sint64 *mtime)
+{
+    WIN32_FILE_ATTRIBUTE_DATA attr;
+    WCHAR *wpath = wide_path(path);
+    BOOL found;
+
+    if(wpath == NULL)
+        return -1;
+
+    found = GetFileAttributesExW(wpath, GetFileExInfoStandard, &attr);
+    SDL_free(wpath);
+    if(!found)
+        return -1;
+
+    *size = ((Uint64)attr.nFileSizeHigh << 32) | attr.nFileSizeLow;
+    *mtime = (Sint64)(((Uint64)attr.ftLastWriteTime.dwHighDateTime << 32) | attr.ftLastWriteTime.dwLowDateTime);
+
+    return 0;
+}
+
+static void *map_file(const char *path, size_t *size)
+{
+    HANDLE file, mapping;
+    LARGE_INTEGER file_size;
+    WCHAR *wpath = wide_path(path);
+    void *data = NULL;
+
+    if(wpath == NULL)
+        return NULL;
+
+    file = CreateFileW(wpath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    SDL_free(wpath);
+    if(file == INVALID_HANDLE_VALUE)
+        return NULL;
+
+    if(GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0)
+    {
+        mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if(mapping != NULL)
+        {
+            data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            *size = (size_t)file_size.QuadPart;
+            CloseHandle(mapping);
         }
-        else
+    }
+
+    CloseHandle(file);
+
+    return data;
+}
+
+static void unmap_file(void *data, size_t size)
+{
+    (void)size;
+    UnmapViewOfFile(data);
+}
+
+static int replace_file(const char *from, const char *to)
+{
+    WCHAR *wfrom = wide_path(from);
+    WCHAR *wto = wide_path(to);
+    int ret = -1;
+
+    if(wfrom != NULL && wto != NULL && MoveFileExW(wfrom, wto, MOVEFILE_REPLACE_EXISTING))
+        ret = 0;
+
+    SDL_free(wfrom);
+    SDL_free(wto);
+
+    return ret;
+}
+
+static void remove_file(const char *path)
+{
+    WCHAR *wpath = wide_path(path);
+
+    if(wpath != NULL)
+        DeleteFileW(wpath);
+    SDL_free(wpath);
+}
+#else
+static int file_stamp(const char *path, Uint64 *size, Sint64 *mtime)
+{
+    struct stat st;
+
+    if(stat(path, &st) != 0)
+        return -1;
+
+    *size = (Uint64)st.st_size;
+#ifdef __APPLE__
+    *mtime = (Sint64)st.st_mtimespec.tv_sec * 1000000000 + st.st_mtimespec.tv_nsec;
+#else
+    *mtime = (Sint64)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+#endif
+
+    return 0;
+}
+
+static void *map_file(const char *path, size_t *size)
+{
+    struct stat st;
+    void *data = NULL;
+    int fd = open(path, O_RDONLY);
+
+    if(fd < 0)
+        return NULL;
+
+    if(fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(data == MAP_FAILED)
+            data = NULL;
+        *size = (size_t)st.st_size;
+    }
+
+    close(fd);
+
+    return data;
+}
+
+static void unmap_file(void *data, size_t size)
+{
+    munmap(data, size);
+}
+
+static int replace_file(const char *from, const char *to)
+{
+    return rename(from, to);
+}
+
+static void remove_file(const char *path)
+{
+    remove(path);
+}
+#endif
+
+static SDL_bool view_valid(const ini_t *handler, const struct ini_view *v, Uint32 text_size)
+{
+    return (v->offset < text_size && v->length < text_size - v->offset &&
+            handler->text[v->offset + v->length] == '\0') ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Map a cache image, return NULL if it is missing, stale or damaged */
+static ini_t *map_cache(const char *cache_path, Uint64 source_size, Sint64 source_mtime)
+{
+    ini_t *handler;
+    const struct ini_cache_header *h;
+    char *data;
+    size_t size = 0, need;
+    Uint64 cache_size;
+    Sint64 written;
+    Uint32 filled[2] = {0, 0};
+    Sint32 i;
+
+    /*
+     * The source may change again within the same time stamp after it is
+     * parsed, so only trust an image written strictly after the source.
+     */
+    if(file_stamp(cache_path, &cache_size, &written) != 0 || source_mtime >= written)
+        return NULL;
+
+    data = (char *)map_file(cache_path, &size);
+    if(data == NULL)
+        return NULL;
+
+    h = (const struct ini_cache_header *)data;
+    if(size < sizeof(*h) || h->magic != INI_CACHE_MAGIC || h->header_size != sizeof(*h) ||
+       h->source_size != source_size || h->source_mtime != source_mtime ||
+       h->sections_count < 0 || h->args_count < 0 ||
+       h->slots == 0 || (h->slots & (h->slots - 1)) != 0 || h->text_size % 8 != 0)
+    {
+        unmap_file(data, size);
+        return NULL;
+    }
+
+    need = sizeof(*h) + h->text_size +
+           (size_t)h->sections_count * sizeof(struct ini_section) +
+           (size_t)h->args_count * sizeof(struct ini_arg) +
+           2 * (size_t)h->slots * sizeof(Uint32);
+    handler = (ini_t *)SDL_malloc(sizeof(ini_t));
+    if(need != size || handler == NULL)
+    {
+        SDL_free(handler);
+        unmap_file(data, size);
+        return NULL;
+    }
+
+    handler->text = data + sizeof(*h);
+    handler->sections = (struct ini_section *)(handler->text + h->text_size);
+    handler->sections_count = h->sections_count;
+    handler->args = (struct ini_arg *)(handler->sections + h->sections_count);
+    handler->args_count = h->args_count;
+    handler->section_slots = (Uint32 *)(handler->args + h->args_count);
+    handler->arg_slots = handler->section_slots + h->slots;
+    handler->slots_mask = h->slots - 1;
+    handler->mapping = data;
+    handler->mapping_size = size;
+
+    /* Lookups trust the indices, so check every one of them once */
+    for(i = 0; i < handler->sections_count; ++i)
+    {
+        struct ini_section *p = &handler->sections[i];
+        if(!view_valid(handler, &p->name, h->text_size) ||
+           p->args < -1 || p->args >= handler->args_count ||
+           p->last_arg < -1 || p->last_arg >= handler->args_count)
+            break;
+    }
+
+    if(i == handler->sections_count)
+    {
+        for(i = 0; i < handler->args_count; ++i)
         {
-            char *old_value = arg_curr->value;
-            if((arg_curr->value = SDL_strdup(value)) == NULL)
-            {
-                ini_free(head);
-                SDL_free(line);
-                return NULL;
-            }
-            SDL_free(old_value);
+            struct ini_arg *p = &handler->args[i];
+            if(!view_valid(handler, &p->name, h->text_size) || !view_valid(handler, &p->value, h->text_size) ||
+               p->section < 0 || p->section >= handler->sections_count ||
+               p->next < -1 || p->next >= handler->args_count)
+                break;
         }
     }
 
-    SDL_free(line);
-    SDL_RWclose(fp);
+    if(i == handler->args_count)
+    {
+        for(i = 0; i < (Sint32)(2 * h->slots); ++i)
+        {
+            Uint32 n = handler->section_slots[i];
+            int table = i >= (Sint32)h->slots;
+            if(n > (Uint32)(table ? handler->args_count : handler->sections_count))
+                break;
+            if(n != 0)
+                filled[table]++;
+        }
+    }
+
+    /* A probe only ends at an empty slot, and each node fills one slot at most */
+    if(i != (Sint32)(2 * h->slots) ||
+       filled[0] >= h->slots || filled[0] > (Uint32)handler->sections_count ||
+       filled[1] >= h->slots || filled[1] > (Uint32)handler->args_count)
+    {
+        ini_free(handler);
+        return NULL;
+    }
+
+    return handler;
+}
+
+static struct ini_view copy_view(ini_t *image, Uint32 *used, ini_t *handler, struct ini_view v)
+{
+    struct ini_view out;
 
-    if(head == NULL)
+    out.offset = *used;
+    out.length = v.length;
+    SDL_memcpy(image->text + *used, handler->text + v.offset, v.length);
+    image->text[*used + v.length] = '\0';
+    *used += v.length + 1;
+
+    return out;
+}
+
+/*
+ * Write a compacted image of a loaded file: only names and values go to
+ * the string table and the hash tables are rebuilt for the real counts.
+ * The image is written aside and renamed over the old one, so a reader
+ * never sees a partial file. It is dropped if the source changed since
+ * it was stamped before the parse.
+ */
+static int write_cache(ini_t *handler, const char *path, const char *cache_path, Uint64 source_size, Sint64 source_mtime)
+{
+    struct ini_cache_header h;
+    ini_t image;
+    SDL_RWops *out;
+    char *block, *tmp_path;
+    size_t text_size = 0, slots = 16, total, path_size;
+    Uint64 size;
+    Sint64 mtime;
+    Uint32 used = 0;
+    Sint32 i;
+    int ret = -1;
+
+    for(i = 0; i < handler->sections_count; ++i)
+        text_size += handler->sections[i].name.length + 1;
+    for(i = 0; i < handler->args_count; ++i)
+        text_size += handler->args[i].name.length + handler->args[i].value.length + 2;
+    text_size = INI_ALIGN(text_size);
+
+    while(slots < 2 * ((size_t)SDL_max(handler->sections_count, handler->args_count) + 1))
+        slots *= 2;
+
+    total = sizeof(h) + text_size +
+            (size_t)handler->sections_count * sizeof(struct ini_section) +
+            (size_t)handler->args_count * sizeof(struct ini_arg) +
+            2 * slots * sizeof(Uint32);
+
+    block = (char *)SDL_calloc(1, total);
+    if(block == NULL)
+        return -1;
+
+    image.text = block + sizeof(h);
+    image.sections = (struct ini_section *)(image.text + text_size);
+    image.sections_count = handler->sections_count;
+    image.args = (struct ini_arg *)(image.sections + handler->sections_count);
+    image.args_count = handler->args_count;
+    image.section_slots = (Uint32 *)(image.args + handler->args_count);
+    image.arg_slots = image.section_slots + slots;
+    image.slots_mask = (Uint32)(slots - 1);
+
+    /* Node indices stay the same, only the views move */
+    for(i = 0; i < handler->sections_count; ++i)
+    {
+        struct ini_section *p = &image.sections[i];
+        *p = handler->sections[i];
+        p->name = copy_view(&image, &used, handler, p->name);
+        *section_slot(&image, image.text + p->name.offset, p->name.length) = (Uint32)i + 1;
+    }
+
+    for(i = 0; i < handler->args_count; ++i)
+    {
+        struct ini_arg *p = &image.args[i];
+        *p = handler->args[i];
+        p->name = copy_view(&image, &used, handler, p->name);
+        p->value = copy_view(&image, &used, handler, p->value);
+        *arg_slot(&image, p->section, image.text + p->name.offset, p->name.length) = (Uint32)i + 1;
+    }
+
+    h.magic = INI_CACHE_MAGIC;
+    h.header_size = sizeof(h);
+    h.source_size = source_size;
+    h.source_mtime = source_mtime;
+    h.text_size = (Uint32)text_size;
+    h.sections_count = handler->sections_count;
+    h.args_count = handler->args_count;
+    h.slots = (Uint32)slots;
+    SDL_memcpy(block, &h, sizeof(h));
+
+    path_size = SDL_strlen(cache_path) + 5;
+    tmp_path = (char *)SDL_malloc(path_size);
+    if(tmp_path != NULL)
+    {
+        SDL_snprintf(tmp_path, path_size, "%s.tmp", cache_path);
+
+        out = SDL_RWFromFile(tmp_path, "wb");
+        if(out != NULL)
+        {
+            if(SDL_RWwrite(out, block, 1, total) == total)
+                ret = 0;
+            if(SDL_RWclose(out) != 0)
+                ret = -1;
+
+            if(ret == 0 && (file_stamp(path, &size, &mtime) != 0 ||
+                            size != source_size || mtime != source_mtime))
+                ret = -1;
+            if(ret == 0)
+                ret = replace_file(tmp_path, cache_path);
+            if(ret != 0)
+                remove_file(tmp_path);
+        }
+
+        SDL_free(tmp_path);
+    }
+
+    SDL_free(block);
+
+    return ret;
+}
+
+ini_t *ini_load_cached(char *path, char *cache_path)
+{
+    ini_t *handler;
+    Uint64 size;
+    Sint64 mtime;
+    char *own_path = NULL;
+    size_t path_size;
+
+    /* Without a stamp the cache can't be checked, the file may still be readable */
+    if(file_stamp(path, &size, &mtime) != 0)
+        return ini_load(path);
+
+    if(cache_path == NULL)
     {
-        if((head = SDL_calloc(1, sizeof(struct ini_section))) == NULL)
-            return NULL;
+        path_size = SDL_strlen(path) + sizeof(INI_CACHE_SUFFIX);
+        own_path = (char *)SDL_malloc(path_size);
+        if(own_path == NULL)
+            return ini_load(path);
+        SDL_snprintf(own_path, path_size, "%s" INI_CACHE_SUFFIX, path);
+        cache_path = own_path;
     }
 
-    ini_print(head);
+    handler = map_cache(cache_path, size, mtime);
+    if(handler == NULL)
+    {
+        handler = ini_load(path);
+        if(handler != NULL)
+            write_cache(handler, path, cache_path, size, mtime);
+    }
 
-    return head;
+    SDL_free(own_path);
+
+    return handler;
 }
 
 int ini_read_str(ini_t *handler, char *section, char *name, char **value, char *default_value)
 {
-    struct ini_section *curr;
+    Sint32 curr;
+    Sint32 arg;
 
     if(!handler && name && value)
     {
@@ -524,32 +1224,29 @@ int ini_read_str(ini_t *handler, char *section, char *name, char **value, char *
     if(section == NULL || *section == 0)
         section = "global";
 
-    curr = handler;
+    curr = (Sint32)*section_slot(handler, section, SDL_strlen(section)) - 1;
+    arg = curr >= 0 ? (Sint32)*arg_slot(handler, curr, name, SDL_strlen(name)) - 1 : -1;
 
-    while(curr)
+    if(arg >= 0)
     {
-        if(curr->name && SDL_strcmp(section, curr->name) == 0)
-            break;
+        const char *s = handler->text + handler->args[arg].value.offset;
+        size_t len = handler->args[arg].value.length;
 
-        curr = curr->next;
-    }
-
-    if(curr)
-    {
-        struct ini_arg *arg = curr->args;
-
-        while(arg)
+        /* Strip surrounding quotes */
+        if(len >= 2 && s[0] == '"')
         {
-            if(arg->name && arg->value && SDL_strcmp(arg->name, name) == 0)
-            {
-                *value = SDL_strdup(removeQuotes(arg->value, arg->value + SDL_strlen(arg->value)));
-                if(*value == NULL)
-                    return -1;
-                return 0;
-            }
-
-            arg = arg->next;
+            s++;
+            len--;
+            if(s[len - 1] == '"')
+                len--;
         }
+
+        *value = (char *)SDL_malloc(len + 1);
+        if(*value == NULL)
+            return -1;
+        SDL_memcpy(*value, s, len);
+        (*value)[len] = '\0';
+        return 0;
     }
 
     if(default_value)
@@ -7,22 +7,49 @@
 
 #include <stdint.h>
 #include <SDL2/SDL_types.h>
+#include <SDL2/SDL_rwops.h>
+
+/* A name or a value in the loaded text, always followed by a null byte */
+struct ini_view
+{
+    Uint32 offset;
+    Uint32 length;
+};
 
 struct ini_arg
 {
-    char  *name;
-    char  *value;
-    struct ini_arg *next;
+    struct ini_view name;
+    struct ini_view value;
+    Sint32 section;
+    Sint32 next;        /* Next arg of the same section, -1 ends the list */
 };
 
 struct ini_section
 {
-    char  *name;
-    struct ini_arg *args;
-    struct ini_section *next;
+    struct ini_view name;
+    Sint32 args;        /* First arg, -1 if the section is empty */
+    Sint32 last_arg;
 };
 
-typedef struct ini_section ini_t;
+/*
+ * The file is parsed in place: names and values are views into the text,
+ * which lives in one memory block together with the section and arg
+ * arrays, so a loaded file costs a single allocation. Sections and args
+ * are found through open addressing hash tables over case-folded names.
+ */
+typedef struct ini_file
+{
+    char   *text;
+    struct ini_section *sections;
+    Sint32  sections_count;
+    struct ini_arg *args;
+    Sint32  args_count;
+    Uint32 *section_slots;
+    Uint32 *arg_slots;
+    Uint32  slots_mask;
+    void   *mapping;    /* Mapped cache image, if loaded from one */
+    size_t  mapping_size;
+} ini_t;
 
 /*
  * Feature:
@@ -65,6 +92,35 @@ typedef struct ini_section ini_t;
  */
 ini_t *ini_load(char *path);
 
+/*
+ * Same as ini_load, but keep a binary image of the parsed file at
+ * cache_path, or next to it at path + ".cache" when cache_path is NULL.
+ * While the size and the modification time of the file match the ones
+ * recorded in the image, and the file is older than the image, the image
+ * is mapped into memory instead of parsing the file again. Failing to
+ * stat the file, or to write the image, only falls back to ini_load.
+ */
+ini_t *ini_load_cached(char *path, char *cache_path);
+
+/*
+ * Called for every property met by ini_parse_stream. The strings are
+ * only valid during the call. Return non-zero to stop parsing.
+ */
+typedef int (*ini_handler)(void *userdata,
+                           const char *section, const char *name, const char *value);
+
+/*
+ * Parse a config from a stream without building a tree, the handler
+ * gets every property in file order. Properties before any section are
+ * in the "global" section, surrounding quotes of values are removed,
+ * and a repeated property is reported each time. The stream is not
+ * closed.
+ *
+ * Return 0 at the end of the stream, 1 if the handler stopped parsing,
+ * -1 on fail.
+ */
+int ini_parse_stream(SDL_RWops *stream, ini_handler handler, void *userdata);
+
 /*
  * Return value:
  * If the combination of section and name found in config file, return 0.
@@ -0,0 +1,70 @@
+/*
+ * Description: minimal decoder of the LZ4 block format
+ */
+
+#include "lz4dec.h"
+
+/* Read a length extension: a run of 255 bytes terminated by a smaller one */
+static int read_length(const unsigned char **ip, const unsigned char *iend, size_t *len)
+{
+    unsigned char b;
+
+    do
+    {
+        if(*ip >= iend)
+            return -1;
+        b = *(*ip)++;
+        *len += b;
+    } while(b == 255);
+
+    return 0;
+}
+
+long lz4_decompress(const unsigned char *src, size_t src_size,
+                    unsigned char *dst, size_t dst_size)
+{
+    const unsigned char *ip = src, *iend = src + src_size;
+    unsigned char *op = dst, *oend = dst + dst_size;
+    const unsigned char *match;
+    unsigned char token;
+    size_t len, offset;
+
+    while(ip < iend)
+    {
+        token = *ip++;
+
+        /* Literals */
+        len = token >> 4;
+        if(len == 15 && read_length(&ip, iend, &len) < 0)
+            return -1;
+        if(len > (size_t)(iend - ip) || len > (size_t)(oend - op))
+            return -1;
+        while(len--)
+            *op++ = *ip++;
+
+        /* The last sequence has no match part */
+        if(ip >= iend)
+            break;
+
+        if(iend - ip < 2)
+            return -1;
+        offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+        if(offset == 0 || offset > (size_t)(op - dst))
+            return -1;
+
+        len = token & 15;
+        if(len == 15 && read_length(&ip, iend, &len) < 0)
+            return -1;
+        len += 4;
+        if(len > (size_t)(oend - op))
+            return -1;
+
+        /* Byte by byte: the match may overlap the output */
+        match = op - offset;
+        while(len--)
+            *op++ = *match++;
+    }
+
+    return (long)(op - dst);
+}
@@ -0,0 +1,19 @@
+/*
+ * Description: minimal decoder of the LZ4 block format
+ *
+ * Only raw blocks are supported (no frame headers, no checksums). The
+ * decoder never reads or writes out of the given buffers, so broken
+ * input is reported instead of crashing.
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+/*
+ * Decompress a block of src_size bytes into dst of dst_size bytes.
+ * Return the number of bytes written, or -1 if the block is malformed
+ * or doesn't fit into dst.
+ */
+long lz4_decompress(const unsigned char *src, size_t src_size,
+                    unsigned char *dst, size_t dst_size);
@@ -0,0 +1,56 @@
+/*
+ * X-Tech Launcher - a simple template game launcher
+ *
+ * Copyright (c) 2009-2011 Andrew Spinks, original VB6 code
+ * Copyright (c) 2020-2020 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef BLOBFMT_H
+#define BLOBFMT_H
+
+/*
+ * Pre-decoded image blob, produced by blobpack at build time.
+ * All header fields are 32-bit little-endian:
+ *
+ *   magic     "XLB1"
+ *   width     in pixels
+ *   height    in pixels
+ *   pitch     bytes per row, rows are stored top-down
+ *   bpp       bits per pixel, 8 for indexed images
+ *   colors    number of palette entries that follow the header
+ *   key       palette index of the transparent color, BLOB_NO_KEY if opaque
+ *
+ * The header is followed by colors * 4 bytes of R, G, B, A palette
+ * entries and then by pitch * height bytes of pixels.
+ */
+
+#define BLOB_MAGIC          "XLB1"
+#define BLOB_HEADER_SIZE    28
+#define BLOB_NO_KEY         0xFFFFFFFFu
+
+/*
+ * Compressed blob: "XLZ1", 32-bit little-endian size of the blob above,
+ * then the whole blob as one LZ4 block.
+ */
+#define BLOB_LZ4_MAGIC          "XLZ1"
+#define BLOB_LZ4_HEADER_SIZE    8
+
+#endif /* BLOBFMT_H */
@@ -0,0 +1,324 @@
+/*
+ * X-Tech Launcher - a simple template game launcher
+ *
+ * Copyright (c) 2009-2011 Andrew Spinks, original VB6 code
+ * Copyright (c) 2020-2020 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Build-time image packer: converts an uncompressed 4-bit or 8-bit BMP
+ * into the pre-decoded blob described in blobfmt.h, so the launcher can
+ * wrap the pixels into a surface without parsing anything at startup.
+ *
+ * Usage: blobpack [-k] [-z] input.bmp output.blob
+ *   -k    magenta (255, 0, 255) is the transparent color
+ *   -z    compress the blob into one LZ4 block
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "blobfmt.h"
+
+static unsigned long getLE(const unsigned char *p, int bytes)
+{
+    unsigned long v = 0;
+    int i;
+    for(i = bytes - 1; i >= 0; i--)
+        v = (v << 8) | p[i];
+    return v;
+}
+
+/* Signed 32-bit field, without relying on the width of long */
+static long getLE32s(const unsigned char *p)
+{
+    unsigned long v = getLE(p, 4);
+    if(v & 0x80000000UL)
+        return -(long)(0xFFFFFFFFUL - v) - 1;
+    return (long)v;
+}
+
+static unsigned char *putLE32(unsigned char *p, unsigned long v)
+{
+    p[0] = (unsigned char)(v & 0xFF);
+    p[1] = (unsigned char)((v >> 8) & 0xFF);
+    p[2] = (unsigned char)((v >> 16) & 0xFF);
+    p[3] = (unsigned char)((v >> 24) & 0xFF);
+    return p + 4;
+}
+
+static unsigned char *putLength(unsigned char *op, size_t len)
+{
+    for(; len >= 255; len -= 255)
+        *op++ = 255;
+    *op++ = (unsigned char)len;
+    return op;
+}
+
+static unsigned char *putSequence(unsigned char *op, const unsigned char *lit, size_t litLen,
+                                  size_t offset, size_t matchLen)
+{
+    unsigned char *token = op++;
+    size_t ml = matchLen ? matchLen - 4 : 0;
+
+    *token = (unsigned char)((litLen < 15 ? litLen : 15) << 4);
+    if(litLen >= 15)
+        op = putLength(op, litLen - 15);
+    memcpy(op, lit, litLen);
+    op += litLen;
+
+    if(!matchLen)
+        return op;
+
+    *op++ = (unsigned char)(offset & 0xFF);
+    *op++ = (unsigned char)(offset >> 8);
+    *token |= (unsigned char)(ml < 15 ? ml : 15);
+    if(ml >= 15)
+        op = putLength(op, ml - 15);
+
+    return op;
+}
+
+#define HASH_BITS 16
+
+static size_t hash4(const unsigned char *p)
+{
+    unsigned long v = getLE(p, 4);
+    return (size_t)(((v * 2654435761UL) & 0xFFFFFFFFUL) >> (32 - HASH_BITS));
+}
+
+/*
+ * Greedy LZ4 block compressor. The format rules are kept so any LZ4
+ * decoder accepts the output: the last 5 bytes are literals, and the
+ * last match starts at least 12 bytes before the end.
+ */
+static size_t compressLZ4(const unsigned char *src, size_t size, unsigned char *dst)
+{
+    static long table[1 << HASH_BITS];
+    const unsigned char *ip = src, *anchor = src, *ref;
+    const unsigned char *matchLimit = src + (size > 12 ? size - 12 : 0);
+    const unsigned char *end = src + size;
+    unsigned char *op = dst;
+    size_t h, len;
+
+    for(h = 0; h < (1 << HASH_BITS); h++)
+        table[h] = -1;
+
+    while(ip < matchLimit)
+    {
+        h = hash4(ip);
+        ref = table[h] < 0 ? NULL : src + table[h];
+        table[h] = (long)(ip - src);
+
+        if(!ref || ip - ref > 65535 || memcmp(ref, ip, 4) != 0)
+        {
+            ip++;
+            continue;
+        }
+
+        len = 4;
+        while(ip + len < end - 5 && ref[len] == ip[len])
+            len++;
+
+        op = putSequence(op, anchor, (size_t)(ip - anchor), (size_t)(ip - ref), len);
+        ip += len;
+        anchor = ip;
+    }
+
+    return (size_t)(putSequence(op, anchor, (size_t)(end - anchor), 0, 0) - dst);
+}
+
+static unsigned char *readFile(const char *path, long *size)
+{
+    FILE *f = fopen(path, "rb");
+    unsigned char *data;
+
+    if(!f)
+        return NULL;
+
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    data = (unsigned char *)malloc((size_t)*size);
+    if(data && fread(data, 1, (size_t)*size, f) != (size_t)*size)
+    {
+        free(data);
+        data = NULL;
+    }
+
+    fclose(f);
+    return data;
+}
+
+int main(int argc, char **argv)
+{
+    const char *in, *out;
+    unsigned char *bmp, *pal, *row, *blob, *pixels, *p, *packed;
+    unsigned long offset, headerSize, colors, key = BLOB_NO_KEY, i;
+    long size, w, h, x, y, srcY, bpp, srcPitch, pitch;
+    size_t blobSize, packedSize;
+    int useKey = 0, compress = 0, topDown = 0, arg;
+    FILE *f;
+
+    for(arg = 1; arg < argc && argv[arg][0] == '-'; arg++)
+    {
+        if(strcmp(argv[arg], "-k") == 0)
+            useKey = 1;
+        else if(strcmp(argv[arg], "-z") == 0)
+            compress = 1;
+        else
+            break;
+    }
+
+    if(argc - arg != 2)
+    {
+        fprintf(stderr, "Usage: %s [-k] [-z] input.bmp output.blob\n", argv[0]);
+        return 1;
+    }
+
+    in = argv[arg];
+    out = argv[arg + 1];
+
+    bmp = readFile(in, &size);
+    if(!bmp || size < 54 || bmp[0] != 'B' || bmp[1] != 'M')
+    {
+        fprintf(stderr, "%s: not a BMP file\n", in);
+        return 1;
+    }
+
+    offset = getLE(bmp + 10, 4);
+    headerSize = getLE(bmp + 14, 4);
+    w = getLE32s(bmp + 18);
+    h = getLE32s(bmp + 22);
+    bpp = (long)getLE(bmp + 28, 2);
+    colors = getLE(bmp + 46, 4);
+
+    /* Negative height means top-down rows */
+    if(h < 0)
+    {
+        h = -h;
+        topDown = 1;
+    }
+
+    if(getLE(bmp + 30, 4) != 0 || (bpp != 4 && bpp != 8))
+    {
+        fprintf(stderr, "%s: only uncompressed 4-bit and 8-bit images are supported\n", in);
+        return 1;
+    }
+
+    if(colors == 0)
+        colors = 1UL << bpp;
+
+    srcPitch = ((w * bpp + 31) / 32) * 4;
+    pal = bmp + 14 + headerSize;
+    if(offset + (unsigned long)(srcPitch * h) > (unsigned long)size ||
+       pal + colors * 4 > bmp + offset)
+    {
+        fprintf(stderr, "%s: truncated file\n", in);
+        return 1;
+    }
+
+    if(useKey)
+    {
+        for(i = 0; i < colors; i++)
+        {
+            if(pal[i * 4 + 2] == 255 && pal[i * 4 + 1] == 0 && pal[i * 4] == 255)
+            {
+                key = i;
+                break;
+            }
+        }
+
+        if(key == BLOB_NO_KEY)
+            fprintf(stderr, "%s: no magenta in the palette, the image stays opaque\n", in);
+    }
+
+    /* Same row alignment as SDL uses for new 8-bit surfaces */
+    pitch = (w + 3) & ~3L;
+    blobSize = BLOB_HEADER_SIZE + colors * 4 + (size_t)(pitch * h);
+    blob = (unsigned char *)calloc(blobSize, 1);
+    if(!blob)
+        return 1;
+
+    memcpy(blob, BLOB_MAGIC, 4);
+    p = putLE32(blob + 4, (unsigned long)w);
+    p = putLE32(p, (unsigned long)h);
+    p = putLE32(p, (unsigned long)pitch);
+    p = putLE32(p, 8);
+    p = putLE32(p, colors);
+    p = putLE32(p, key);
+
+    for(i = 0; i < colors; i++)
+    {
+        /* BMP palette entries are B, G, R, reserved */
+        *p++ = pal[i * 4 + 2];
+        *p++ = pal[i * 4 + 1];
+        *p++ = pal[i * 4];
+        *p++ = 255;
+    }
+
+    pixels = p;
+    for(y = 0; y < h; y++)
+    {
+        srcY = topDown ? y : h - 1 - y;
+        row = bmp + offset + srcY * srcPitch;
+        for(x = 0; x < w; x++)
+        {
+            if(bpp == 8)
+                pixels[y * pitch + x] = row[x];
+            else
+                pixels[y * pitch + x] = (unsigned char)((x & 1) ? (row[x / 2] & 0x0F) : (row[x / 2] >> 4));
+        }
+    }
+
+    f = fopen(out, "wb");
+    if(!f)
+    {
+        fprintf(stderr, "%s: can't open for writing\n", out);
+        return 1;
+    }
+
+    if(compress)
+    {
+        /* Worst case of LZ4 is a tiny expansion of incompressible data */
+        packed = (unsigned char *)malloc(BLOB_LZ4_HEADER_SIZE + blobSize + blobSize / 255 + 16);
+        if(!packed)
+            return 1;
+
+        memcpy(packed, BLOB_LZ4_MAGIC, 4);
+        putLE32(packed + 4, (unsigned long)blobSize);
+        packedSize = BLOB_LZ4_HEADER_SIZE + compressLZ4(blob, blobSize, packed + BLOB_LZ4_HEADER_SIZE);
+        fwrite(packed, 1, packedSize, f);
+        printf("%s: %lu -> %lu bytes\n", out, (unsigned long)blobSize, (unsigned long)packedSize);
+        free(packed);
+    }
+    else
+        fwrite(blob, 1, blobSize, f);
+
+    fclose(f);
+
+    free(blob);
+    free(bmp);
+
+    return 0;
+}
@@ -1,1963 +0,0 @@
-/*===============================================================*
-   This file is automatically generated by wopn2hpp.sh script
-   PLEASE DON'T EDIT THIS DIRECTLY. Edit the gm.wopn file first,
-   and then run a wopn2hpp.sh script to generate this file again
- *===============================================================*/
-
-static unsigned char g_Font2_2_bmp_bank[] = 
-{
-	0x42, 0x4d, 0x76, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00,
-	0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x94, 0x07,
-	0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x5a,
-	0x00, 0x00, 0x13, 0x0b, 0x00, 0x00, 0x13, 0x0b, 0x00, 0x00, 0x03, 0x00,
-	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x42, 0x47, 0x52, 0x73, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff,
-	0xff, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x11, 0x11, 0x00, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x11, 0x11, 0x00, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x00, 0x22, 0x22, 0x22, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x00, 0x22, 0x22, 0x22, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x00, 0x22, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x00, 0x22, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x22, 0x22, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x00, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x00, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x00, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00
-};
-
@@ -1,6 +1,11 @@
 #!/bin/bash
 
-./wopn2hpp.sh Font2_2.bmp font2.h
-./wopn2hpp.sh back.bmp back.h
-./wopn2hpp.sh splash.bmp splash.h
+# Decode images at build time, the launcher only wraps ready pixels.
+# Resulting blobs are embedded by resources.S
+cc -O2 -Wall -o blobpack blobpack.c || exit 1
 
+./blobpack -k -z Font2_2.bmp font2.blob
+./blobpack -z back.bmp back.blob
+./blobpack -k -z splash.bmp splash.blob
+
+rm -f blobpack
@@ -25,11 +25,13 @@
 
 #include "app.h"
 #include "menu.h"
+#include "pixops.h"
+#include "render.h"
 #include "ini.h"
+#include "lz4dec.h"
 
-#include "font2.h"
-#include "back.h"
-#include "splash.h"
+#include "resources.h"
+#include "blobfmt.h"
 
 #include <locale.h>
 
@@ -209,8 +211,35 @@ void initApp(App *a)
     a->m_windowHeight = 432;
 
     a->m_font = NULL;
+    a->m_fontSurface = NULL;
+    a->m_fontTintsCount = 0;
     a->m_back = NULL;
+    SDL_memset(a->m_images, 0, sizeof(a->m_images));
+    a->m_setupThread = NULL;
+    a->m_inputDevicesReady = SDL_FALSE;
+    a->m_startupBegin = SDL_GetPerformanceCounter();
+    a->m_startupLast = a->m_startupBegin;
     a->m_splash = NULL;
+    a->m_atlas = NULL;
+    a->m_atlasWidth = 0;
+    a->m_atlasHeight = 0;
+    a->m_atlasGlyphsCount = 0;
+    a->m_static = NULL;
+    a->m_staticSurface = NULL;
+    a->m_faderSurface = NULL;
+    a->m_backSurface = NULL;
+    a->m_splashSurface = NULL;
+    a->m_staticIndexed = NULL;
+    a->m_staticFadeLevel = -1;
+
+    a->m_textRunsCount = 0;
+    a->m_textRunsClock = 0;
+
+    a->m_textGeometry = SDL_FALSE;
+    a->m_textBatchOpen = SDL_FALSE;
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    a->m_textBatchQuads = 0;
+#endif
 
     a->m_gamePath = NULL;
     a->m_editorPath = NULL;
@@ -220,6 +249,21 @@ void initApp(App *a)
 
     a->optNoSound = SDL_FALSE;
     a->optFrameSkip = SDL_FALSE;
+    a->optFadeMode = FADE_AUTO;
+    a->optVSync = SDL_FALSE;
+    a->m_rendererName = NULL;
+    a->m_softwareRenderer = SDL_FALSE;
+    a->m_vsync = SDL_FALSE;
+    a->m_surfaceMode = SDL_FALSE;
+    a->m_screen = NULL;
+    a->m_target = NULL;
+    a->m_updateRectsCount = 0;
+    a->m_updateFull = SDL_TRUE;
+    a->m_compositor = NULL;
+    a->optComposeThreads = 0;
+    a->m_renderThread = NULL;
+    a->optRenderThread = SDL_FALSE;
+    a->m_fadeDuration = 300;
 }
 
 int initSdl(void)
@@ -231,20 +275,85 @@ int initSdl(void)
 #endif
     sdlInitFlags |= SDL_INIT_VIDEO;
     sdlInitFlags |= SDL_INIT_EVENTS;
-    sdlInitFlags |= SDL_INIT_JOYSTICK;
+    /* Joysticks are initialized later by initInputDevices(), device probing is slow */
 
     /* Initialize SDL */
-    return (SDL_Init(sdlInitFlags) == 0);
+    if(SDL_Init(sdlInitFlags) != 0)
+        return 0;
+
+    initPixelKernels();
+    SDL_Log("Pixel kernels: %s", pixelKernelsName());
+
+    return 1;
+}
+
+/*
+ * Deferred until the first frame is on the screen: opening every input
+ * device may take a while, and the menu doesn't need them to appear.
+ */
+void initInputDevices(App *a)
+{
+    if(a->m_inputDevicesReady)
+        return;
+
+    a->m_inputDevicesReady = SDL_TRUE;
+
+    if(SDL_InitSubSystem(SDL_INIT_JOYSTICK | SDL_INIT_GAMECONTROLLER) != 0)
+        SDL_Log("Can't init input devices: %s", SDL_GetError());
+
+    logStartupPhase(a, "input devices");
 }
 
 void quitSdl(App *a)
 {
+    size_t i;
+
+    waitSetup(a);
+
+    /* Holds references to surfaces which are freed below */
+    destroyCompositor(a->m_compositor);
+    a->m_compositor = NULL;
+
+    clearTextCache(a);
+    for(i = 0; i < a->m_fontTintsCount; i++)
+    {
+        if(a->m_fontTints[i].texture)
+            SDL_DestroyTexture(a->m_fontTints[i].texture);
+        if(a->m_fontTints[i].surface)
+            SDL_FreeSurface(a->m_fontTints[i].surface);
+    }
     if(a->m_font)
         SDL_DestroyTexture(a->m_font);
+    if(a->m_fontSurface)
+        SDL_FreeSurface(a->m_fontSurface);
     if(a->m_splash)
         SDL_DestroyTexture(a->m_splash);
+    if(a->m_atlas)
+        SDL_DestroyTexture(a->m_atlas);
     if(a->m_back)
         SDL_DestroyTexture(a->m_back);
+    if(a->m_static)
+        SDL_DestroyTexture(a->m_static);
+    if(a->m_staticIndexed)
+        SDL_FreeSurface(a->m_staticIndexed);
+    if(a->m_staticSurface)
+        SDL_FreeSurface(a->m_staticSurface);
+    if(a->m_faderSurface)
+        SDL_FreeSurface(a->m_faderSurface);
+    if(a->m_splashSurface)
+        SDL_FreeSurface(a->m_splashSurface);
+    if(a->m_backSurface)
+        SDL_FreeSurface(a->m_backSurface);
+    for(i = 0; i < IMAGE_COUNT; i++)
+    {
+        /* Startup may have failed before all images were taken */
+        if(a->m_images[i].thread)
+            SDL_WaitThread(a->m_images[i].thread, NULL);
+        if(a->m_images[i].surface)
+            SDL_FreeSurface(a->m_images[i].surface);
+        if(a->m_images[i].data)
+            SDL_free(a->m_images[i].data);
+    }
     if(a->m_gRenderer)
         SDL_DestroyRenderer(a->m_gRenderer);
     if(a->m_window)
@@ -255,6 +364,8 @@ void quitSdl(App *a)
         SDL_free(a->m_gamePath);
     if(a->m_editorPath)
         SDL_free(a->m_editorPath);
+    if(a->m_rendererName)
+        SDL_free(a->m_rendererName);
 
     SDL_ClearError();
     SDL_Quit();
@@ -266,17 +377,194 @@ int isSdlError(void)
     return (*error != '\0');
 }
 
+/*
+ * Parsed config image in the user's pref dir, named after the launcher
+ * location so that several installs don't share one image
+ */
+static char *setupCachePath(void)
+{
+    char *pref = SDL_GetPrefPath("X-Tech", "launcher");
+    char *base = SDL_GetBasePath();
+    char *path = NULL;
+    const char *c;
+    Uint32 hash = 2166136261u;
+    size_t size;
+
+    if(pref && base)
+    {
+        for(c = base; *c; ++c)
+            hash = (hash ^ (Uint8)*c) * 16777619u;
+
+        size = SDL_strlen(pref) + 32;
+        path = (char *)SDL_malloc(size);
+        if(path)
+            SDL_snprintf(path, size, "%slauncher-%08x.ini.cache", pref, (unsigned int)hash);
+    }
+
+    SDL_free(pref);
+    SDL_free(base);
+
+    return path;
+}
+
 void loadSetup(App *a)
 {
-    ini_t *i = ini_load("launcher.ini");
+    char *fade = NULL, *threads = NULL;
+    char *cachePath = setupCachePath();
+    ini_t *i = cachePath ? ini_load_cached("launcher.ini", cachePath) : ini_load("launcher.ini");
+
+    SDL_free(cachePath);
+
     ini_read_str(i, "main", "title", &a->m_windowTitle, "<Untitled game launcher>");
     ini_read_str(i, "app", "game", &a->m_gamePath, NULL);
     ini_read_str(i, "app", "editor", &a->m_editorPath, NULL);
+
+    ini_read_int(i, "video", "fade-duration", &a->m_fadeDuration, 300);
+    if(a->m_fadeDuration < 0)
+        a->m_fadeDuration = 0;
+
+    /* Dirty rects and the palette fade are tuned for software, accelerated drivers are opt-in */
+    ini_read_str(i, "video", "renderer", &a->m_rendererName, "software");
+    ini_read_bool(i, "video", "vsync", &a->optVSync, SDL_FALSE);
+
+    ini_read_str(i, "video", "fade", &fade, "auto");
+    if(fade)
+    {
+        if(SDL_strcasecmp(fade, "palette") == 0)
+            a->optFadeMode = FADE_PALETTE;
+        else if(SDL_strcasecmp(fade, "overlay") == 0)
+            a->optFadeMode = FADE_OVERLAY;
+        else
+            a->optFadeMode = FADE_AUTO;
+        SDL_free(fade);
+    }
+
+    ini_read_bool(i, "video", "render-thread", &a->optRenderThread, SDL_FALSE);
+    /* Other renderers are tied to the main thread */
+    if(a->optRenderThread && (!a->m_rendererName || SDL_strcasecmp(a->m_rendererName, "surface") != 0))
+    {
+        SDL_Log("Config error: render-thread = true needs renderer = surface, option ignored");
+        a->optRenderThread = SDL_FALSE;
+    }
+
+    ini_read_str(i, "video", "compose-threads", &threads, "0");
+    if(threads)
+    {
+        if(SDL_strcasecmp(threads, "auto") == 0)
+            a->optComposeThreads = -1;
+        else
+            a->optComposeThreads = SDL_atoi(threads);
+        SDL_free(threads);
+    }
+
     ini_free(i);
 }
 
+static int findRenderDriver(const char *name)
+{
+    SDL_RendererInfo info;
+    int i, n = SDL_GetNumRenderDrivers();
+
+    for(i = 0; i < n; i++)
+    {
+        if(SDL_GetRenderDriverInfo(i, &info) == 0 && SDL_strcasecmp(info.name, name) == 0)
+            return i;
+    }
+
+    return -1;
+}
+
+static SDL_Renderer *tryRenderer(App *a, int index, Uint32 flags)
+{
+    SDL_RendererInfo info;
+    SDL_Renderer *r;
+
+    if(SDL_GetRenderDriverInfo(index, &info) < 0)
+        return NULL;
+
+    r = SDL_CreateRenderer(a->m_window, index, flags);
+    if(!r)
+        SDL_Log("Can't init %s renderer: %s", info.name, SDL_GetError());
+
+    return r;
+}
+
+/*
+ * Create the renderer requested by the config. When it's unavailable or
+ * fails, go down the list of drivers in SDL's order with software as the
+ * last resort.
+ */
+static SDL_Renderer *createRenderer(App *a)
+{
+    SDL_Renderer *r = NULL;
+    Uint32 flags = a->optVSync ? SDL_RENDERER_PRESENTVSYNC : 0;
+    int i, n = SDL_GetNumRenderDrivers(), preferred = -1, software;
+    const char *name = a->m_rendererName ? a->m_rendererName : "software";
+
+    software = findRenderDriver("software");
+
+    if(SDL_strcasecmp(name, "auto") != 0)
+    {
+        preferred = findRenderDriver(name);
+        if(preferred < 0)
+            SDL_Log("Renderer %s is not available", name);
+        else
+            r = tryRenderer(a, preferred, flags);
+    }
+
+    for(i = 0; !r && i < n; i++)
+    {
+        if(i != preferred && i != software)
+            r = tryRenderer(a, i, flags);
+    }
+
+    if(!r && software >= 0 && software != preferred)
+        r = tryRenderer(a, software, flags);
+
+    return r;
+}
+
+static int loadSetupThread(void *data)
+{
+    loadSetup((App *)data);
+    return 0;
+}
+
+/* Window creation is the first step which needs the config */
+void startLoadingSetup(App *a)
+{
+    a->m_setupThread = SDL_CreateThread(loadSetupThread, "setup", a);
+    if(!a->m_setupThread)
+        loadSetup(a);
+}
+
+void waitSetup(App *a)
+{
+    if(a->m_setupThread)
+    {
+        SDL_WaitThread(a->m_setupThread, NULL);
+        a->m_setupThread = NULL;
+    }
+}
+
+/* Log time spent since the previous phase and since the start, for tracking time-to-first-frame */
+void logStartupPhase(App *a, const char *phase)
+{
+    Uint64 now = SDL_GetPerformanceCounter();
+    double freq = (double)SDL_GetPerformanceFrequency();
+
+    SDL_Log("Startup: %s in %.2f ms (%.2f ms total)", phase,
+            (double)(now - a->m_startupLast) * 1000.0 / freq,
+            (double)(now - a->m_startupBegin) * 1000.0 / freq);
+
+    a->m_startupLast = now;
+}
+
 int initWindow(App *a)
 {
+    SDL_RendererInfo info;
+    Uint64 start;
+
     SDL_ClearError();
     SDL_GL_ResetAttributes();
 
@@ -304,21 +592,136 @@ int initWindow(App *a)
 
     SDL_SetWindowMinimumSize(a->m_window, a->m_windowWidth, a->m_windowHeight);
 
-    a->m_gRenderer = SDL_CreateRenderer(a->m_window, -1, SDL_RENDERER_SOFTWARE);
+    start = SDL_GetPerformanceCounter();
+
+    if(a->m_rendererName && SDL_strcasecmp(a->m_rendererName, "surface") == 0)
+    {
+        a->m_screen = SDL_GetWindowSurface(a->m_window);
+        if(a->m_screen)
+        {
+            a->m_surfaceMode = SDL_TRUE;
+            a->m_softwareRenderer = SDL_TRUE;
+            a->m_target = a->m_screen;
+            SDL_Log("Renderer: window surface, created in %.2f ms",
+                    (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / (double)SDL_GetPerformanceFrequency());
+
+            /* Own kernels of the compositor work with 32-bit pixels only */
+            if(a->optComposeThreads != 0 && a->m_screen->format->BytesPerPixel == 4)
+            {
+                a->m_compositor = createCompositor(a->optComposeThreads);
+                if(a->m_compositor)
+                    SDL_Log("Compositor: %d thread(s)", a->m_compositor->m_threadsCount);
+            }
+
+            SDL_ShowWindow(a->m_window);
+            return 0;
+        }
+
+        SDL_Log("Can't get window surface: %s", SDL_GetError());
+    }
+
+    a->m_gRenderer = createRenderer(a);
     if(!a->m_gRenderer)
     {
         SDL_Log("Can't init renderer: %s", SDL_GetError());
         return 3;
     }
 
+    SDL_zero(info);
+    SDL_GetRendererInfo(a->m_gRenderer, &info);
+    a->m_softwareRenderer = (info.flags & SDL_RENDERER_SOFTWARE) ? SDL_TRUE : SDL_FALSE;
+    a->m_vsync = (info.flags & SDL_RENDERER_PRESENTVSYNC) ? SDL_TRUE : SDL_FALSE;
+
+    SDL_Log("Renderer: %s%s, created in %.2f ms", info.name,
+            a->m_vsync ? " (vsync)" : "",
+            (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / (double)SDL_GetPerformanceFrequency());
+
     SDL_SetRenderDrawBlendMode(a->m_gRenderer, SDL_BLENDMODE_BLEND);
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    /*
+     * On accelerated backends every copy is a separate draw command, so
+     * submit text as geometry. The software renderer rasterizes geometry
+     * as generic triangles, its plain blits are faster there.
+     */
+    {
+        int i;
+
+        a->m_textGeometry = (info.flags & SDL_RENDERER_ACCELERATED) ? SDL_TRUE : SDL_FALSE;
+
+        for(i = 0; i < TEXT_BATCH_MAX_QUADS; i++)
+        {
+            a->m_textBatchIndices[i * 6 + 0] = i * 4 + 0;
+            a->m_textBatchIndices[i * 6 + 1] = i * 4 + 1;
+            a->m_textBatchIndices[i * 6 + 2] = i * 4 + 2;
+            a->m_textBatchIndices[i * 6 + 3] = i * 4 + 2;
+            a->m_textBatchIndices[i * 6 + 4] = i * 4 + 1;
+            a->m_textBatchIndices[i * 6 + 5] = i * 4 + 3;
+        }
+    }
+#endif
+
     SDL_ShowWindow(a->m_window);
 
     return 0;
 }
 
+void resizeWindow(App *a, int w, int h)
+{
+    a->m_windowWidth = w;
+    a->m_windowHeight = h;
+    if(a->m_surfaceMode)
+    {
+        /* Old window surface is invalid after resize */
+        a->m_screen = SDL_GetWindowSurface(a->m_window);
+        a->m_target = a->m_screen;
+    }
+    initStaticLayer(a);
+}
+
+/* Window events touch the drawing state owned by the render thread */
+static SDL_bool forwardEvent(App *a)
+{
+    RenderThread *r = a->m_renderThread;
+
+    if(!r)
+        return SDL_FALSE;
+
+    if(handleRenderEvent(r, &a->m_event))
+        return SDL_TRUE;
+
+    switch(a->m_event.type)
+    {
+    case SDL_MOUSEBUTTONUP:
+        if(a->m_event.button.button == SDL_BUTTON_LEFT)
+            pushMenuInput(r, INPUT_CLICK, a->m_event.button.x, a->m_event.button.y);
+        return SDL_FALSE;
+
+    case SDL_MOUSEMOTION:
+        pushMenuInput(r, INPUT_MOTION, a->m_event.motion.x, a->m_event.motion.y);
+        return SDL_FALSE;
+
+    case SDL_KEYDOWN:
+        pushMenuInput(r, INPUT_KEY, (int)a->m_event.key.keysym.scancode, 0);
+        return SDL_FALSE;
+
+    case SDL_WINDOWEVENT:
+        if(a->m_event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED)
+            pushMenuInput(r, INPUT_RESIZE, a->m_event.window.data1, a->m_event.window.data2);
+        else if(a->m_event.window.event == SDL_WINDOWEVENT_EXPOSED)
+            pushMenuInput(r, INPUT_EXPOSE, 0, 0);
+        return SDL_TRUE;
+    }
+
+    return SDL_FALSE;
+}
+
 void processEvent(Menu *m, App *a)
 {
+    /* Menu logic and actions still run here, the render thread only redraws */
+    if(forwardEvent(a))
+        return;
+
     switch(a->m_event.type)
     {
     case SDL_QUIT:
@@ -339,6 +742,28 @@ void processEvent(Menu *m, App *a)
     case SDL_KEYDOWN:
         processMenuKeyboard(m, a, (int)a->m_event.key.keysym.scancode);
         break;
+
+    case SDL_WINDOWEVENT:
+        if(a->m_event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED)
+        {
+            resizeWindow(a, a->m_event.window.data1, a->m_event.window.data2);
+            invalidateMenu(m);
+        }
+        else if(a->m_event.window.event == SDL_WINDOWEVENT_EXPOSED)
+            invalidateMenu(m);
+        break;
+
+    case SDL_RENDER_TARGETS_RESET:
+        /* Content of target textures got lost */
+        clearTextCache(a);
+        invalidateMenu(m);
+        break;
+
+    case SDL_RENDER_DEVICE_RESET:
+        clearTextCache(a);
+        initStaticLayer(a);
+        invalidateMenu(m);
+        break;
     }
 }
 
@@ -356,167 +781,887 @@ void doEvents(Menu *m, App *a)
         processEvent(m, a);
 }
 
-SDL_Texture *loadTexture(App *a, void *src, int size, SDL_bool key)
+void waitEventsUntil(Menu *m, App *a, Uint64 deadline)
 {
-    SDL_RWops* font = SDL_RWFromMem(src, size);
-    SDL_Surface *surface, *tempSur;
-    SDL_Texture *dst = NULL;
-    Uint32 rmask, gmask, bmask, amask;
+    Uint64 now, freq = SDL_GetPerformanceFrequency();
+    int timeout;
 
-    surface = SDL_LoadBMP_RW(font, 1);
-    if(!surface)
+    doEvents(m, a);
+
+    /* Sleep on the event queue instead of spinning until the deadline */
+    for(;;)
     {
-        SDL_Log("Can't load BMP: %s", SDL_GetError());
-        return NULL;
+        now = SDL_GetPerformanceCounter();
+        if(now >= deadline)
+            break;
+
+        timeout = (int)(((deadline - now) * 1000) / freq);
+        if(timeout <= 0)
+            break;
+
+        if(SDL_WaitEventTimeout(&a->m_event, timeout))
+            processEvent(m, a);
     }
+}
+
+/* Little-endian 32-bit field of a blob header */
+static Uint32 blobField(const unsigned char *p)
+{
+    return (Uint32)p[0] | ((Uint32)p[1] << 8) | ((Uint32)p[2] << 16) | ((Uint32)p[3] << 24);
+}
+
+/*
+ * Wrap a pre-decoded image blob (see blobfmt.h) into a surface: pixels
+ * and palette are used in place, nothing gets parsed or converted.
+ * Keyed images get their color key RLE-encoded, so surface blits skip
+ * transparent runs instead of blending every pixel of an RGBA copy.
+ */
+static SDL_Surface *loadBlob(const unsigned char *src, size_t size)
+{
+    SDL_Surface *surface;
+    Uint32 w, h, pitch, bpp, colors, key;
 
-    if(key)
+    if(size < BLOB_HEADER_SIZE || SDL_memcmp(src, BLOB_MAGIC, 4) != 0)
     {
-#if SDL_BYTEORDER != SDL_BIG_ENDIAN
-        rmask = 0xff000000;
-        gmask = 0x00ff0000;
-        bmask = 0x0000ff00;
-        amask = 0x000000ff;
-#else
-        rmask = 0x000000ff;
-        gmask = 0x0000ff00;
-        bmask = 0x00ff0000;
-        amask = 0xff000000;
-#endif
+        SDL_Log("Can't load image: bad blob header");
+        return NULL;
+    }
 
-        SDL_SetColorKey(surface, SDL_TRUE, SDL_MapRGB(surface->format, 255, 0, 255));
+    w = blobField(src + 4);
+    h = blobField(src + 8);
+    pitch = blobField(src + 12);
+    bpp = blobField(src + 16);
+    colors = blobField(src + 20);
+    key = blobField(src + 24);
 
-        tempSur = SDL_CreateRGBSurface(SDL_SWSURFACE, surface->w, surface->h, 32, rmask, gmask, bmask, amask);
-        SDL_BlitSurface(surface, NULL, tempSur,NULL);
+    if(bpp != 8 || colors > 256 || pitch < w ||
+       size < BLOB_HEADER_SIZE + colors * 4 + (size_t)pitch * h)
+    {
+        SDL_Log("Can't load image: bad blob header");
+        return NULL;
+    }
 
-        dst = SDL_CreateTextureFromSurface(a->m_gRenderer, tempSur);
-        SDL_FreeSurface(surface);
-        SDL_FreeSurface(tempSur);
+    /* Surface doesn't own the pixels and never writes into them */
+    surface = SDL_CreateRGBSurfaceWithFormatFrom((void *)(src + BLOB_HEADER_SIZE + colors * 4),
+                                                 (int)w, (int)h, 8, (int)pitch,
+                                                 SDL_PIXELFORMAT_INDEX8);
+    if(!surface)
+    {
+        SDL_Log("Can't load image: %s", SDL_GetError());
+        return NULL;
     }
-    else
+
+    SDL_SetPaletteColors(surface->format->palette, (const SDL_Color *)(src + BLOB_HEADER_SIZE), 0, (int)colors);
+
+    if(key != BLOB_NO_KEY)
     {
-        dst = SDL_CreateTextureFromSurface(a->m_gRenderer, surface);
-        SDL_FreeSurface(surface);
+        SDL_SetColorKey(surface, SDL_TRUE, key);
+        SDL_SetSurfaceRLE(surface, 1);
     }
 
-    return dst;
+    return surface;
 }
 
-int initFont(App *a)
+/* Decompress the blob if it's packed and wrap it into a surface */
+static int decodeImage(void *data)
 {
-    int fSize = sizeof(g_Font2_2_bmp_bank);
-    a->m_font = loadTexture(a, g_Font2_2_bmp_bank, fSize, SDL_TRUE);
-    if(!a->m_font)
+    ImageLoad *img = (ImageLoad *)data;
+    Uint64 start = SDL_GetPerformanceCounter();
+    size_t rawSize;
+    long got;
+
+    if(img->size >= BLOB_LZ4_HEADER_SIZE && SDL_memcmp(img->src, BLOB_LZ4_MAGIC, 4) == 0)
     {
-        SDL_Log("Can't init font: %s", SDL_GetError());
-        return 1;
+        rawSize = blobField(img->src + 4);
+        img->data = (unsigned char *)SDL_malloc(rawSize);
+        if(!img->data)
+            return 1;
+
+        got = lz4_decompress(img->src + BLOB_LZ4_HEADER_SIZE, img->size - BLOB_LZ4_HEADER_SIZE,
+                             img->data, rawSize);
+        if(got != (long)rawSize)
+        {
+            SDL_Log("Can't load image: broken compressed data");
+            return 1;
+        }
+
+        img->surface = loadBlob(img->data, rawSize);
     }
+    else
+        img->surface = loadBlob(img->src, img->size);
 
-    return 0;
+    img->time = SDL_GetPerformanceCounter() - start;
+
+    return img->surface ? 0 : 1;
 }
 
-int initTextures(App *a)
-{
-    int fSize;
+static const char *s_imageNames[IMAGE_COUNT] = {"font", "back", "splash"};
 
-    fSize = sizeof(g_back_bmp_bank);
-    a->m_back = loadTexture(a, g_back_bmp_bank, fSize, SDL_FALSE);
-    if(!a->m_back)
-        return 1;
+/* Decode all embedded images concurrently while the window is being created */
+void startLoadingImages(App *a)
+{
+    int i;
 
-    fSize = sizeof(g_splash_bmp_bank);
-    a->m_splash = loadTexture(a, g_splash_bmp_bank, fSize, SDL_TRUE);
-    if(!a->m_splash)
-        return 1;
+    a->m_images[IMAGE_FONT].src = g_font2_blob_start;
+    a->m_images[IMAGE_FONT].size = RESOURCE_SIZE(g_font2_blob);
+    a->m_images[IMAGE_BACK].src = g_back_blob_start;
+    a->m_images[IMAGE_BACK].size = RESOURCE_SIZE(g_back_blob);
+    a->m_images[IMAGE_SPLASH].src = g_splash_blob_start;
+    a->m_images[IMAGE_SPLASH].size = RESOURCE_SIZE(g_splash_blob);
 
-    return 0;
+    for(i = 0; i < IMAGE_COUNT; i++)
+        a->m_images[i].thread = SDL_CreateThread(decodeImage, s_imageNames[i], &a->m_images[i]);
 }
 
-void renderTexture(App *app, int xDst, int yDst, int wDst, int hDst,
-                   SDL_Texture *t,
-                   int xSrc, int ySrc, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+/* Take the decoded image, decodes it here if the worker couldn't be started */
+static SDL_Surface *takeImage(App *a, int id)
 {
-    SDL_Rect destRect;
-    SDL_Rect sourceRect;
+    ImageLoad *img = &a->m_images[id];
+    SDL_Surface *s;
+    Uint64 start = SDL_GetPerformanceCounter();
 
-    destRect.x = xDst;
-    destRect.y = yDst;
-    destRect.w = wDst;
-    destRect.h = hDst;
-    sourceRect.x = xSrc;
-    sourceRect.y = ySrc;
-    sourceRect.w = wDst;
-    sourceRect.h = hDst;
+    if(img->thread)
+    {
+        SDL_WaitThread(img->thread, NULL);
+        img->thread = NULL;
+    }
+    else if(!img->surface && img->src)
+        decodeImage(img);
 
-    SDL_SetTextureColorMod(t, r, g, b);
-    SDL_SetTextureAlphaMod(t, a);
-    SDL_RenderCopyEx(app->m_gRenderer, t, &sourceRect, &destRect, 0, NULL, SDL_FLIP_NONE);
+    /* Waiting time is what the decoding still adds to the startup */
+    SDL_Log("Image %s (%u bytes embedded) decoded in %.2f ms, waited %.2f ms", s_imageNames[id],
+            (unsigned)img->size,
+            (double)img->time * 1000.0 / (double)SDL_GetPerformanceFrequency(),
+            (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / (double)SDL_GetPerformanceFrequency());
+
+    s = img->surface;
+    img->surface = NULL;
+    img->src = NULL;
+
+    return s;
 }
 
-void renderTextureS(App *app, int x, int y, SDL_Texture *t)
+/* Make a copy of the font with the tint baked into pixels */
+static SDL_Texture *createFontTint(App *a, Uint8 r, Uint8 g, Uint8 b)
 {
-    SDL_Rect destRect;
-    SDL_Rect sourceRect;
-    int w, h;
-    SDL_QueryTexture(t, NULL, NULL, &w, &h);
+    SDL_Surface *src = a->m_fontSurface, *tinted;
+    SDL_Texture *dst;
 
-    destRect.x = x;
-    destRect.y = y;
-    destRect.w = w;
-    destRect.h = h;
-    sourceRect.x = 0;
-    sourceRect.y = 0;
-    sourceRect.w = w;
-    sourceRect.h = h;
+    /* New surface is fully transparent, keyed pixels are skipped by the blit */
+    tinted = SDL_CreateRGBSurfaceWithFormat(0, src->w, src->h, 32, SDL_PIXELFORMAT_ARGB8888);
+    if(!tinted)
+        return NULL;
 
-    SDL_SetTextureColorMod(t, 255, 255, 255);
-    SDL_SetTextureAlphaMod(t, 255);
-    SDL_RenderCopyEx(app->m_gRenderer, t, &sourceRect, &destRect, 0, NULL, SDL_FLIP_NONE);
+    SDL_BlitSurface(src, NULL, tinted, NULL);
+    tintSurface(tinted, r, g, b);
+
+    dst = SDL_CreateTextureFromSurface(a->m_gRenderer, tinted);
+    SDL_FreeSurface(tinted);
+
+    return dst;
 }
 
-void printText(App *app, const char *text, int x, int y, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+/* Create a color-keyed surface in the screen format, RLE blits need identical formats */
+static SDL_Surface *createKeyedSurface(App *a, int w, int h)
 {
-    size_t len = SDL_strlen(text);
-    const char *cc = text, *c_end = text + len;
-    char c;
-    int B = 0, C = 0;
+    SDL_Surface *s;
+    Uint32 key;
 
-    for(; cc != c_end; cc++)
-    {
-        c = *cc;
-        if(c >= 'a' && c <= 'z')
-            c += 'A' - 'a';
+    s = SDL_CreateRGBSurfaceWithFormat(0, w, h, a->m_screen->format->BitsPerPixel,
+                                       a->m_screen->format->format);
+    if(!s)
+        return NULL;
 
-        if(c >= 33 && c <= 126)
-        {
-            C = (c - 33) * 32;
-            renderTexture(app, x + B, y, 18, 16, app->m_font, 2, C, r, g, b, a);
-            B += 18;
-            if(c == 'M')
-                B += 2;
-        }
-        else
-        {
-            B += 16;
-        }
-    }
+    key = SDL_MapRGB(s->format, 255, 0, 255);
+    SDL_FillRect(s, NULL, key);
+    SDL_SetColorKey(s, SDL_TRUE, key);
+
+    return s;
 }
 
-void getTextBlockSize(const char *text, int *w, int *h)
+/* Same as createFontTint(), but for the framebuffer mode */
+static SDL_Surface *createFontTintSurface(App *a, Uint8 r, Uint8 g, Uint8 b)
 {
-    size_t len = SDL_strlen(text);
-    const char *cc = text, *c_end = text + len;
-    char c;
-    int B = 0;
+    SDL_Surface *src = a->m_fontSurface, *tinted;
 
-    for(; cc != c_end; cc++)
+    tinted = createKeyedSurface(a, src->w, src->h);
+    if(!tinted)
+        return NULL;
+
+    /* Untouched key pixels stay transparent */
+    SDL_BlitSurface(src, NULL, tinted, NULL);
+    if(tintSurface(tinted, r, g, b) != 0)
     {
-        c = *cc;
-        if(c >= 'a' && c <= 'z')
-            c += 'A' - 'a';
+        SDL_SetSurfaceColorMod(src, r, g, b);
+        SDL_BlitSurface(src, NULL, tinted, NULL);
+        SDL_SetSurfaceColorMod(src, 255, 255, 255);
+    }
+
+    /* The compositor reads raw pixels */
+    if(!a->m_compositor)
+        SDL_SetSurfaceRLE(tinted, 1);
+
+    return tinted;
+}
+
+/*
+ * Find the font copy pre-tinted with a given color, missing tints are
+ * created on demand. Returns NULL when the tint set is full, then the
+ * caller should fall back to the color modulation of the base font.
+ */
+static FontTint *findFontTint(App *a, Uint8 r, Uint8 g, Uint8 b)
+{
+    size_t i;
+    FontTint *t;
+
+    for(i = 0; i < a->m_fontTintsCount; i++)
+    {
+        t = &a->m_fontTints[i];
+        if(t->r == r && t->g == g && t->b == b)
+            return t;
+    }
+
+    if(!a->m_fontSurface || a->m_fontTintsCount >= SDL_arraysize(a->m_fontTints))
+        return NULL;
+
+    t = &a->m_fontTints[a->m_fontTintsCount];
+    t->r = r;
+    t->g = g;
+    t->b = b;
+    t->texture = NULL;
+    t->surface = NULL;
+
+    if(a->m_surfaceMode)
+        t->surface = createFontTintSurface(a, r, g, b);
+    else
+        t->texture = createFontTint(a, r, g, b);
+
+    if(!t->texture && !t->surface)
+    {
+        SDL_Log("Can't create font tint: %s", SDL_GetError());
+        return NULL;
+    }
+
+    a->m_fontTintsCount++;
+
+    return t;
+}
+
+static SDL_Texture *getFontTint(App *a, Uint8 r, Uint8 g, Uint8 b)
+{
+    FontTint *t;
+
+    if(r == 255 && g == 255 && b == 255)
+        return a->m_font;
+
+    t = findFontTint(a, r, g, b);
+
+    return t ? t->texture : NULL;
+}
+
+static SDL_Surface *getFontTintSurface(App *a, Uint8 r, Uint8 g, Uint8 b)
+{
+    FontTint *t = findFontTint(a, r, g, b);
+    return t ? t->surface : NULL;
+}
+
+int initFont(App *a)
+{
+    a->m_fontSurface = takeImage(a, IMAGE_FONT);
+    if(!a->m_fontSurface)
+    {
+        SDL_Log("Can't init font: %s", SDL_GetError());
+        return 1;
+    }
+
+    if(a->m_surfaceMode)
+    {
+        /* In the framebuffer mode the base font is just another tint */
+        if(!getFontTintSurface(a, 255, 255, 255))
+        {
+            SDL_Log("Can't init font: %s", SDL_GetError());
+            return 1;
+        }
+    }
+    else
+    {
+        a->m_font = SDL_CreateTextureFromSurface(a->m_gRenderer, a->m_fontSurface);
+        if(!a->m_font)
+        {
+            SDL_Log("Can't init font: %s", SDL_GetError());
+            return 1;
+        }
+    }
+
+    /* Tints used by the menu */
+    getFontTint(a, 128, 255, 255);
+    getFontTint(a, 255, 128, 128);
+
+    return 0;
+}
+
+/*
+ * Pack the font glyphs into one texture: glyph cells go in rows with one
+ * pixel gap against bleeding. Text geometry of a whole frame then draws
+ * from a single small texture. The splash is not packed, as it reaches
+ * the screen through the pre-composed static layer.
+ */
+static int initAtlas(App *a)
+{
+    SDL_Surface *atlas;
+    SDL_Rect src, *dst;
+    int i, perRow, rows;
+
+    a->m_atlasWidth = 512;
+    perRow = a->m_atlasWidth / 19;
+    a->m_atlasGlyphsCount = SDL_min((a->m_fontSurface->h - 16) / 32 + 1, ATLAS_MAX_GLYPHS);
+    rows = (a->m_atlasGlyphsCount + perRow - 1) / perRow;
+    a->m_atlasHeight = rows * 17;
+
+    /* New surface is fully transparent, keyed pixels are skipped by the blits */
+    atlas = SDL_CreateRGBSurfaceWithFormat(0, a->m_atlasWidth, a->m_atlasHeight, 32, SDL_PIXELFORMAT_ARGB8888);
+    if(!atlas)
+    {
+        a->m_atlasGlyphsCount = 0;
+        return 1;
+    }
+
+    for(i = 0; i < a->m_atlasGlyphsCount; i++)
+    {
+        src.x = 2;
+        src.y = i * 32;
+        src.w = 18;
+        src.h = 16;
+
+        dst = &a->m_atlasGlyphs[i];
+        dst->x = (i % perRow) * 19;
+        dst->y = (i / perRow) * 17;
+        dst->w = 18;
+        dst->h = 16;
+        SDL_BlitSurface(a->m_fontSurface, &src, atlas, dst);
+    }
+
+    a->m_atlas = SDL_CreateTextureFromSurface(a->m_gRenderer, atlas);
+    SDL_FreeSurface(atlas);
+
+    if(!a->m_atlas)
+    {
+        SDL_Log("Can't create texture atlas: %s", SDL_GetError());
+        a->m_atlasGlyphsCount = 0;
+        return 1;
+    }
+
+    return 0;
+}
+
+int initTextures(App *a)
+{
+    a->m_backSurface = takeImage(a, IMAGE_BACK);
+    if(!a->m_backSurface)
+        return 1;
+
+    a->m_splashSurface = takeImage(a, IMAGE_SPLASH);
+    if(!a->m_splashSurface)
+        return 1;
+
+    /* The framebuffer mode blits surfaces directly */
+    if(a->m_surfaceMode)
+        return 0;
+
+    a->m_back = SDL_CreateTextureFromSurface(a->m_gRenderer, a->m_backSurface);
+    if(!a->m_back)
+        return 1;
+
+    initAtlas(a);
+
+    a->m_splash = SDL_CreateTextureFromSurface(a->m_gRenderer, a->m_splashSurface);
+    if(!a->m_splash)
+        return 1;
+
+    return 0;
+}
+
+/* Find a color in the palette or append it, returns -1 when palette is full */
+static int paletteIndex(SDL_Color *colors, int *count, SDL_Color c)
+{
+    int i;
+
+    for(i = 0; i < *count; i++)
+    {
+        if(colors[i].r == c.r && colors[i].g == c.g && colors[i].b == c.b)
+            return i;
+    }
+
+    if(*count >= 256)
+        return -1;
+
+    colors[*count] = c;
+    return (*count)++;
+}
+
+/*
+ * Compose background and splash into one 8-bit surface: colors of the splash
+ * are merged into the palette of the background, so the whole layer can be
+ * faded by rescaling a single palette.
+ */
+static int initIndexedLayer(App *a)
+{
+    SDL_Palette *bp = a->m_backSurface->format->palette;
+    SDL_Palette *sp = a->m_splashSurface->format->palette;
+    SDL_Surface *layer, *splash = a->m_splashSurface;
+    SDL_Color white;
+    Uint8 map[256];
+    Uint32 key;
+    Uint8 *srcRow, *dstRow;
+    int i, x, y, n, idx, w, h;
+
+    if(!bp || !sp || SDL_GetColorKey(splash, &key) < 0)
+        return 1;
+
+    if(a->m_backSurface->format->BytesPerPixel != 1 || splash->format->BytesPerPixel != 1)
+        return 1;
+
+    n = 0;
+    for(i = 0; i < bp->ncolors; i++)
+        a->m_staticPalette[n++] = bp->colors[i];
+
+    for(i = 0; i < sp->ncolors; i++)
+    {
+        if((Uint32)i == key)
+            continue;
+        idx = paletteIndex(a->m_staticPalette, &n, sp->colors[i]);
+        if(idx < 0)
+            return 1;
+        map[i] = (Uint8)idx;
+    }
+
+    white.r = white.g = white.b = white.a = 255;
+    idx = paletteIndex(a->m_staticPalette, &n, white);
+    if(idx < 0)
+        return 1;
+
+    layer = SDL_CreateRGBSurfaceWithFormat(0, a->m_windowWidth, a->m_windowHeight,
+                                           8, SDL_PIXELFORMAT_INDEX8);
+    if(!layer)
+        return 1;
+
+    SDL_SetPaletteColors(layer->format->palette, a->m_staticPalette, 0, n);
+    SDL_FillRect(layer, NULL, (Uint32)idx);
+
+    /* Background keeps its palette entries: a plain copy of indices */
+    w = SDL_min(a->m_backSurface->w, layer->w);
+    h = SDL_min(a->m_backSurface->h, layer->h);
+
+    SDL_LockSurface(a->m_backSurface);
+    for(y = 0; y < h; y++)
+    {
+        srcRow = (Uint8 *)a->m_backSurface->pixels + y * a->m_backSurface->pitch;
+        dstRow = (Uint8 *)layer->pixels + y * layer->pitch;
+        SDL_memcpy(dstRow, srcRow, (size_t)w);
+    }
+    SDL_UnlockSurface(a->m_backSurface);
+
+    w = SDL_min(splash->w, layer->w - 50);
+    h = SDL_min(splash->h, layer->h - 80);
+
+    SDL_LockSurface(splash);
+    for(y = 0; y < h; y++)
+    {
+        srcRow = (Uint8 *)splash->pixels + y * splash->pitch;
+        dstRow = (Uint8 *)layer->pixels + (y + 80) * layer->pitch + 50;
+        for(x = 0; x < w; x++)
+        {
+            if(srcRow[x] != key)
+                dstRow[x] = map[srcRow[x]];
+        }
+    }
+    SDL_UnlockSurface(splash);
+
+    a->m_staticIndexed = layer;
+
+    return 0;
+}
+
+/*
+ * Scale the palette of the indexed static layer by the fade level and
+ * re-expand it into the streaming texture (or the screen-format surface
+ * in the framebuffer mode): 256 color writes and one
+ * lookup blit instead of blending a black rectangle over the whole frame.
+ */
+static void fadeStaticLayer(App *a, int level)
+{
+    SDL_Color colors[256];
+    SDL_Palette *pal = a->m_staticIndexed->format->palette;
+    SDL_Surface *target;
+    void *pixels;
+    int i, pitch;
+
+    if(level < 0)
+        level = 0;
+    if(level > 255)
+        level = 255;
+
+    if(level == a->m_staticFadeLevel)
+        return;
+
+    for(i = 0; i < pal->ncolors; i++)
+    {
+        colors[i].r = (Uint8)(a->m_staticPalette[i].r * level / 255);
+        colors[i].g = (Uint8)(a->m_staticPalette[i].g * level / 255);
+        colors[i].b = (Uint8)(a->m_staticPalette[i].b * level / 255);
+        colors[i].a = 255;
+    }
+    SDL_SetPaletteColors(pal, colors, 0, pal->ncolors);
+
+    if(a->m_staticSurface)
+    {
+        SDL_BlitSurface(a->m_staticIndexed, NULL, a->m_staticSurface, NULL);
+        a->m_staticFadeLevel = level;
+        return;
+    }
+
+    if(SDL_LockTexture(a->m_static, NULL, &pixels, &pitch) < 0)
+        return;
+
+    target = SDL_CreateRGBSurfaceWithFormatFrom(pixels, a->m_windowWidth, a->m_windowHeight,
+                                                32, pitch, SDL_PIXELFORMAT_RGB888);
+    if(target)
+    {
+        SDL_BlitSurface(a->m_staticIndexed, NULL, target, NULL);
+        SDL_FreeSurface(target);
+    }
+
+    SDL_UnlockTexture(a->m_static);
+
+    a->m_staticFadeLevel = level;
+}
+
+SDL_bool isPaletteFade(App *a)
+{
+    return (a->m_staticIndexed && (a->m_static || a->m_staticSurface)) ? SDL_TRUE : SDL_FALSE;
+}
+
+void updateStaticLayer(App *a)
+{
+    if(isPaletteFade(a))
+        fadeStaticLayer(a, a->fadeLevel);
+}
+
+void renderStaticLayer(App *a)
+{
+    updateStaticLayer(a);
+
+    if(a->m_surfaceMode)
+    {
+        if(a->m_staticSurface)
+            renderSurfaceS(a, 0, 0, a->m_staticSurface);
+    }
+    else if(a->m_static)
+    {
+        /* Pre-composed background and splash logo */
+        renderTextureS(a, 0, 0, a->m_static);
+    }
+    else
+    {
+        /* Background */
+        renderTextureS(a, 0, 0, a->m_back);
+        /* Splash logo */
+        renderTextureS(a, 50, 80, a->m_splash);
+    }
+}
+
+void setClipRect(App *a, const SDL_Rect *clip)
+{
+    if(a->m_surfaceMode)
+        SDL_SetClipRect(a->m_target, clip);
+    else
+        SDL_RenderSetClipRect(a->m_gRenderer, clip);
+}
+
+void setUpdateRects(App *a, const SDL_Rect *rects, int count)
+{
+    int i;
+
+    if(!rects || count > (int)SDL_arraysize(a->m_updateRects))
+    {
+        a->m_updateFull = SDL_TRUE;
+        a->m_updateRectsCount = 0;
+        return;
+    }
+
+    for(i = 0; i < count; i++)
+        a->m_updateRects[i] = rects[i];
+    a->m_updateRectsCount = count;
+    a->m_updateFull = SDL_FALSE;
+}
+
+/*
+ * In the framebuffer mode only the changed rectangles of the window
+ * surface are pushed to the screen, without the renderer-to-window copy.
+ */
+void presentFrame(App *a)
+{
+    if(!a->m_surfaceMode)
+    {
+        SDL_RenderPresent(a->m_gRenderer);
+        return;
+    }
+
+    if(a->m_compositor)
+        composeFlush(a->m_compositor, a->m_screen);
+
+    if(a->m_updateFull)
+        SDL_UpdateWindowSurface(a->m_window);
+    else if(a->m_updateRectsCount > 0)
+        SDL_UpdateWindowSurfaceRects(a->m_window, a->m_updateRects, a->m_updateRectsCount);
+
+    a->m_updateRectsCount = 0;
+    a->m_updateFull = SDL_FALSE;
+}
+
+/* Static layer of the framebuffer mode, in the screen format */
+static int initStaticSurface(App *a)
+{
+    SDL_Rect dst;
+    SDL_PixelFormat *fmt = a->m_screen->format;
+
+    a->m_staticSurface = SDL_CreateRGBSurfaceWithFormat(0, a->m_windowWidth, a->m_windowHeight,
+                                                        fmt->BitsPerPixel, fmt->format);
+    if(!a->m_staticSurface)
+    {
+        SDL_Log("Can't create static layer: %s", SDL_GetError());
+        return 1;
+    }
+
+    /* The fader must cover the window, recreate it after a resize */
+    if(a->m_faderSurface &&
+       (a->m_faderSurface->w != a->m_windowWidth || a->m_faderSurface->h != a->m_windowHeight ||
+        a->m_faderSurface->format->format != fmt->format))
+    {
+        SDL_FreeSurface(a->m_faderSurface);
+        a->m_faderSurface = NULL;
+    }
+
+    if(!a->m_faderSurface)
+    {
+        a->m_faderSurface = SDL_CreateRGBSurfaceWithFormat(0, a->m_windowWidth, a->m_windowHeight,
+                                                           fmt->BitsPerPixel, fmt->format);
+        if(a->m_faderSurface)
+            SDL_SetSurfaceBlendMode(a->m_faderSurface, SDL_BLENDMODE_BLEND);
+    }
+
+    if(a->optFadeMode != FADE_OVERLAY && initIndexedLayer(a) == 0)
+    {
+        a->m_staticFadeLevel = -1;
+        fadeStaticLayer(a, a->fadeLevel);
+        return 0;
+    }
+
+    SDL_FillRect(a->m_staticSurface, NULL, SDL_MapRGB(fmt, 255, 255, 255));
+    SDL_BlitSurface(a->m_backSurface, NULL, a->m_staticSurface, NULL);
+    dst.x = 50;
+    dst.y = 80;
+    SDL_BlitSurface(a->m_splashSurface, NULL, a->m_staticSurface, &dst);
+
+    return 0;
+}
+
+int initStaticLayer(App *a)
+{
+    SDL_Surface *layer;
+    SDL_Rect dst;
+    SDL_bool usePalette = SDL_FALSE;
+
+    if(a->m_static)
+    {
+        SDL_DestroyTexture(a->m_static);
+        a->m_static = NULL;
+    }
+
+    if(a->m_staticSurface)
+    {
+        SDL_FreeSurface(a->m_staticSurface);
+        a->m_staticSurface = NULL;
+    }
+
+    if(a->m_staticIndexed)
+    {
+        SDL_FreeSurface(a->m_staticIndexed);
+        a->m_staticIndexed = NULL;
+    }
+
+    if(a->m_surfaceMode)
+        return initStaticSurface(a);
+
+    /* On accelerated renderers the overlay blend is cheaper than a texture upload */
+    if(a->optFadeMode == FADE_PALETTE)
+        usePalette = SDL_TRUE;
+    else if(a->optFadeMode == FADE_AUTO)
+        usePalette = a->m_softwareRenderer;
+
+    if(usePalette && initIndexedLayer(a) == 0)
+    {
+        a->m_static = SDL_CreateTexture(a->m_gRenderer, SDL_PIXELFORMAT_RGB888,
+                                        SDL_TEXTUREACCESS_STREAMING,
+                                        a->m_windowWidth, a->m_windowHeight);
+        if(a->m_static)
+        {
+            SDL_SetTextureBlendMode(a->m_static, SDL_BLENDMODE_NONE);
+            a->m_staticFadeLevel = -1;
+            fadeStaticLayer(a, a->fadeLevel);
+            return 0;
+        }
+
+        SDL_Log("Can't create palette fade layer: %s", SDL_GetError());
+        SDL_FreeSurface(a->m_staticIndexed);
+        a->m_staticIndexed = NULL;
+    }
+
+    layer = SDL_CreateRGBSurfaceWithFormat(0, a->m_windowWidth, a->m_windowHeight,
+                                           32, SDL_PIXELFORMAT_RGB888);
+    if(!layer)
+    {
+        SDL_Log("Can't create static layer: %s", SDL_GetError());
+        return 1;
+    }
+
+    SDL_FillRect(layer, NULL, SDL_MapRGB(layer->format, 255, 255, 255));
+    SDL_BlitSurface(a->m_backSurface, NULL, layer, NULL);
+    /* RLE blit: transparent runs of the splash are skipped entirely */
+    dst.x = 50;
+    dst.y = 80;
+    SDL_BlitSurface(a->m_splashSurface, NULL, layer, &dst);
+
+    a->m_static = SDL_CreateTextureFromSurface(a->m_gRenderer, layer);
+    SDL_FreeSurface(layer);
+
+    if(!a->m_static)
+    {
+        SDL_Log("Can't create static layer: %s", SDL_GetError());
+        return 1;
+    }
+
+    /* The layer is opaque: copy it as-is without blending */
+    SDL_SetTextureBlendMode(a->m_static, SDL_BLENDMODE_NONE);
+
+    return 0;
+}
+
+void renderTexture(App *app, int xDst, int yDst, int wDst, int hDst,
+                   SDL_Texture *t,
+                   int xSrc, int ySrc, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    SDL_Rect destRect;
+    SDL_Rect sourceRect;
+
+    destRect.x = xDst;
+    destRect.y = yDst;
+    destRect.w = wDst;
+    destRect.h = hDst;
+    sourceRect.x = xSrc;
+    sourceRect.y = ySrc;
+    sourceRect.w = wDst;
+    sourceRect.h = hDst;
+
+    SDL_SetTextureColorMod(t, r, g, b);
+    SDL_SetTextureAlphaMod(t, a);
+    SDL_RenderCopyEx(app->m_gRenderer, t, &sourceRect, &destRect, 0, NULL, SDL_FLIP_NONE);
+}
+
+void renderTextureS(App *app, int x, int y, SDL_Texture *t)
+{
+    SDL_Rect destRect;
+    SDL_Rect sourceRect;
+    int w, h;
+    SDL_QueryTexture(t, NULL, NULL, &w, &h);
+
+    destRect.x = x;
+    destRect.y = y;
+    destRect.w = w;
+    destRect.h = h;
+    sourceRect.x = 0;
+    sourceRect.y = 0;
+    sourceRect.w = w;
+    sourceRect.h = h;
+
+    SDL_SetTextureColorMod(t, 255, 255, 255);
+    SDL_SetTextureAlphaMod(t, 255);
+    SDL_RenderCopyEx(app->m_gRenderer, t, &sourceRect, &destRect, 0, NULL, SDL_FLIP_NONE);
+}
+
+void renderSurface(App *app, int xDst, int yDst, int wDst, int hDst,
+                   SDL_Surface *s, int xSrc, int ySrc)
+{
+    SDL_Rect destRect;
+    SDL_Rect sourceRect;
+
+    destRect.x = xDst;
+    destRect.y = yDst;
+    destRect.w = wDst;
+    destRect.h = hDst;
+    sourceRect.x = xSrc;
+    sourceRect.y = ySrc;
+    sourceRect.w = wDst;
+    sourceRect.h = hDst;
+
+    if(app->m_compositor && app->m_target == app->m_screen)
+        composeCopy(app->m_compositor, app->m_target, s, &sourceRect, &destRect);
+    else
+        SDL_BlitSurface(s, &sourceRect, app->m_target, &destRect);
+}
+
+void renderSurfaceS(App *app, int x, int y, SDL_Surface *s)
+{
+    SDL_Rect destRect;
+
+    destRect.x = x;
+    destRect.y = y;
+    destRect.w = s->w;
+    destRect.h = s->h;
+
+    if(app->m_compositor && app->m_target == app->m_screen)
+        composeCopy(app->m_compositor, app->m_target, s, NULL, &destRect);
+    else
+        SDL_BlitSurface(s, NULL, app->m_target, &destRect);
+}
+
+/* Darken the framebuffer in place, non-zero when the target format isn't supported */
+int fadeTarget(App *a, const SDL_Rect *r, Uint8 level)
+{
+    if(a->m_compositor && a->m_target == a->m_screen)
+    {
+        composeFade(a->m_compositor, a->m_target, r, level);
+        return 0;
+    }
+
+    return fadeSurface(a->m_target, r, level);
+}
+
+/*
+ * Layout pass shared by the text rendering and measuring: places up to
+ * maxGlyphs glyphs of the string and returns the full width of the string.
+ */
+static int layoutText(const char *text, TextGlyph *glyphs, size_t maxGlyphs, size_t *count)
+{
+    size_t len = SDL_strlen(text), n = 0;
+    const char *cc = text, *c_end = text + len;
+    char c;
+    int B = 0;
+
+    for(; cc != c_end; cc++)
+    {
+        c = *cc;
+        if(c >= 'a' && c <= 'z')
+            c += 'A' - 'a';
 
         if(c >= 33 && c <= 126)
         {
+            if(glyphs && n < maxGlyphs)
+            {
+                glyphs[n].x = B;
+                glyphs[n].srcY = (c - 33) * 32;
+            }
+            n++;
             B += 18;
             if(c == 'M')
                 B += 2;
@@ -527,6 +1672,310 @@ void getTextBlockSize(const char *text, int *w, int *h)
         }
     }
 
-    *w = B;
+    if(count)
+        *count = n;
+
+    return B;
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+static void flushTextBatch(App *app)
+{
+    if(app->m_textBatchQuads > 0)
+    {
+        SDL_RenderGeometry(app->m_gRenderer, app->m_atlas ? app->m_atlas : app->m_font,
+                           app->m_textBatchVertices, app->m_textBatchQuads * 4,
+                           app->m_textBatchIndices, app->m_textBatchQuads * 6);
+        app->m_textBatchQuads = 0;
+    }
+}
+
+static void batchGlyph(App *app, int x, int y, int srcY, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    SDL_Vertex *v;
+    float fw = (float)app->m_fontSurface->w, fh = (float)app->m_fontSurface->h;
+    float u0 = 2.0f / fw, u1 = 20.0f / fw;
+    float v0 = (float)srcY / fh, v1 = (float)(srcY + 16) / fh;
+    const SDL_Rect *cell;
+    int i;
+
+    if(app->m_atlas)
+    {
+        if(srcY / 32 >= app->m_atlasGlyphsCount)
+            return;
+        cell = &app->m_atlasGlyphs[srcY / 32];
+        fw = (float)app->m_atlasWidth;
+        fh = (float)app->m_atlasHeight;
+        u0 = (float)cell->x / fw;
+        u1 = (float)(cell->x + cell->w) / fw;
+        v0 = (float)cell->y / fh;
+        v1 = (float)(cell->y + cell->h) / fh;
+    }
+
+    if(app->m_textBatchQuads >= TEXT_BATCH_MAX_QUADS)
+        flushTextBatch(app);
+
+    v = &app->m_textBatchVertices[app->m_textBatchQuads * 4];
+    for(i = 0; i < 4; i++)
+    {
+        v[i].position.x = (float)(x + ((i & 1) ? 18 : 0));
+        v[i].position.y = (float)(y + ((i & 2) ? 16 : 0));
+        v[i].tex_coord.x = (i & 1) ? u1 : u0;
+        v[i].tex_coord.y = (i & 2) ? v1 : v0;
+        v[i].color.r = r;
+        v[i].color.g = g;
+        v[i].color.b = b;
+        v[i].color.a = a;
+    }
+
+    app->m_textBatchQuads++;
+}
+#endif
+
+void beginTextBatch(App *app)
+{
+    app->m_textBatchOpen = app->m_textGeometry;
+}
+
+void endTextBatch(App *app)
+{
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if(app->m_textBatchOpen)
+        flushTextBatch(app);
+#endif
+    app->m_textBatchOpen = SDL_FALSE;
+}
+
+/*
+ * Draw text with a tint scaled by fade/255. Only the base tint picks a
+ * pre-tinted font copy, the transient fade is applied by color modulation
+ * so a fade doesn't fill the tint set with one-off colors.
+ */
+static void printTextFaded(App *app, const char *text, int x, int y,
+                           Uint8 r, Uint8 g, Uint8 b, Uint8 fade, Uint8 a)
+{
+    TextGlyph stackGlyphs[64], *glyphs = stackGlyphs;
+    size_t i, count;
+    SDL_Texture *font;
+    SDL_Surface *fontSurface;
+
+    layoutText(text, glyphs, SDL_arraysize(stackGlyphs), &count);
+    if(count > SDL_arraysize(stackGlyphs))
+    {
+        glyphs = (TextGlyph *)SDL_malloc(count * sizeof(TextGlyph));
+        if(!glyphs)
+            return;
+        layoutText(text, glyphs, count, &count);
+    }
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    /* Tint is passed by vertex colors, the whole string is a single draw */
+    if(app->m_textGeometry)
+    {
+        for(i = 0; i < count; i++)
+            batchGlyph(app, x + glyphs[i].x, y, glyphs[i].srcY,
+                       (Uint8)(r * fade / 255), (Uint8)(g * fade / 255), (Uint8)(b * fade / 255), a);
+        if(!app->m_textBatchOpen)
+            flushTextBatch(app);
+        if(glyphs != stackGlyphs)
+            SDL_free(glyphs);
+        return;
+    }
+#endif
+
+    if(app->m_surfaceMode)
+    {
+        fontSurface = getFontTintSurface(app, r, g, b);
+        if(fontSurface)
+            SDL_SetSurfaceColorMod(fontSurface, fade, fade, fade);
+        else
+        {
+            fontSurface = getFontTintSurface(app, 255, 255, 255);
+            SDL_SetSurfaceColorMod(fontSurface,
+                                   (Uint8)(r * fade / 255), (Uint8)(g * fade / 255), (Uint8)(b * fade / 255));
+        }
+
+        for(i = 0; i < count; i++)
+            renderSurface(app, x + glyphs[i].x, y, 18, 16, fontSurface, 2, glyphs[i].srcY);
+
+        SDL_SetSurfaceColorMod(fontSurface, 255, 255, 255);
+
+        if(glyphs != stackGlyphs)
+            SDL_free(glyphs);
+        return;
+    }
+
+    font = getFontTint(app, r, g, b);
+
+    /* Pre-tinted copies are only modulated by the fade */
+    if(font)
+        r = g = b = fade;
+    else
+    {
+        font = app->m_font;
+        r = (Uint8)(r * fade / 255);
+        g = (Uint8)(g * fade / 255);
+        b = (Uint8)(b * fade / 255);
+    }
+
+    for(i = 0; i < count; i++)
+        renderTexture(app, x + glyphs[i].x, y, 18, 16, font, 2, glyphs[i].srcY, r, g, b, a);
+
+    if(glyphs != stackGlyphs)
+        SDL_free(glyphs);
+}
+
+void printText(App *app, const char *text, int x, int y, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    printTextFaded(app, text, x, y, r, g, b, 255, a);
+}
+
+void clearTextCache(App *app)
+{
+    size_t i;
+
+    for(i = 0; i < app->m_textRunsCount; i++)
+    {
+        SDL_free(app->m_textRuns[i].text);
+        if(app->m_textRuns[i].texture)
+            SDL_DestroyTexture(app->m_textRuns[i].texture);
+        if(app->m_textRuns[i].surface)
+            SDL_FreeSurface(app->m_textRuns[i].surface);
+    }
+
+    app->m_textRunsCount = 0;
+}
+
+static TextRun *createTextRun(App *app, TextRun *run, const char *text, Uint8 r, Uint8 g, Uint8 b)
+{
+    getTextBlockSize(text, &run->w, &run->h);
+    run->h = 16; /* Height of the glyph itself */
+    run->r = r;
+    run->g = g;
+    run->b = b;
+    run->text = SDL_strdup(text);
+    run->texture = NULL;
+    run->surface = NULL;
+
+    if(!run->text || run->w <= 0)
+        return NULL;
+
+    if(app->m_surfaceMode)
+    {
+        run->surface = createKeyedSurface(app, run->w, run->h);
+        if(!run->surface)
+            return NULL;
+
+        app->m_target = run->surface;
+        printText(app, text, 0, 0, r, g, b, 255);
+        app->m_target = app->m_screen;
+
+        if(!app->m_compositor)
+            SDL_SetSurfaceRLE(run->surface, 1);
+
+        return run;
+    }
+
+    run->texture = SDL_CreateTexture(app->m_gRenderer, SDL_PIXELFORMAT_ARGB8888,
+                                     SDL_TEXTUREACCESS_TARGET, run->w, run->h);
+    if(!run->texture)
+        return NULL;
+
+    if(SDL_SetRenderTarget(app->m_gRenderer, run->texture) < 0)
+        return NULL;
+
+    SDL_SetRenderDrawColor(app->m_gRenderer, 0, 0, 0, 0);
+    SDL_RenderClear(app->m_gRenderer);
+    printText(app, text, 0, 0, r, g, b, 255);
+    SDL_SetRenderTarget(app->m_gRenderer, NULL);
+
+    SDL_SetTextureBlendMode(run->texture, SDL_BLENDMODE_BLEND);
+
+    return run;
+}
+
+static TextRun *getTextRun(App *app, const char *text, Uint8 r, Uint8 g, Uint8 b)
+{
+    size_t i;
+    TextRun *run, *oldest = NULL;
+
+    for(i = 0; i < app->m_textRunsCount; i++)
+    {
+        run = &app->m_textRuns[i];
+        if(run->r == r && run->g == g && run->b == b && SDL_strcmp(run->text, text) == 0)
+        {
+            run->lastUse = ++app->m_textRunsClock;
+            return run;
+        }
+
+        if(!oldest || run->lastUse < oldest->lastUse)
+            oldest = run;
+    }
+
+    if(!app->m_surfaceMode && !SDL_RenderTargetSupported(app->m_gRenderer))
+        return NULL;
+
+    if(app->m_textRunsCount < SDL_arraysize(app->m_textRuns))
+        run = &app->m_textRuns[app->m_textRunsCount++];
+    else
+    {
+        /* Evict the least recently used tint of any label */
+        run = oldest;
+        SDL_free(run->text);
+        if(run->texture)
+            SDL_DestroyTexture(run->texture);
+        if(run->surface)
+            SDL_FreeSurface(run->surface);
+    }
+
+    run->lastUse = ++app->m_textRunsClock;
+
+    if(!createTextRun(app, run, text, r, g, b))
+    {
+        SDL_Log("Can't create text run: %s", SDL_GetError());
+        SDL_free(run->text);
+        if(run->texture)
+            SDL_DestroyTexture(run->texture);
+        if(run->surface)
+            SDL_FreeSurface(run->surface);
+        *run = app->m_textRuns[--app->m_textRunsCount];
+        return NULL;
+    }
+
+    return run;
+}
+
+void printTextCached(App *app, const char *text, int x, int y, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    TextRun *run;
+    int fade = 255;
+
+    /* Palette fade darkens the static layer only, labels are modulated here */
+    if(isPaletteFade(app))
+        fade = SDL_max(0, SDL_min(255, app->fadeLevel));
+
+    /* Batched glyphs share one texture, separate run textures would break the batch */
+    run = app->m_textGeometry ? NULL : getTextRun(app, text, r, g, b);
+
+    if(!run)
+    {
+        printTextFaded(app, text, x, y, r, g, b, (Uint8)fade, a);
+        return;
+    }
+
+    if(run->surface)
+    {
+        SDL_SetSurfaceColorMod(run->surface, (Uint8)fade, (Uint8)fade, (Uint8)fade);
+        SDL_SetSurfaceAlphaMod(run->surface, a);
+        renderSurfaceS(app, x, y, run->surface);
+        return;
+    }
+
+    renderTexture(app, x, y, run->w, run->h, run->texture, 0, 0, (Uint8)fade, (Uint8)fade, (Uint8)fade, a);
+}
+
+void getTextBlockSize(const char *text, int *w, int *h)
+{
+    *w = layoutText(text, NULL, 0, NULL);
     *h = 20;
 }
@@ -28,18 +28,140 @@
 
 #include <SDL2/SDL.h>
 
+#include "compose.h"
+
 struct Menu_t;
 typedef struct Menu_t Menu;
 
+typedef struct TextRun_t
+{
+    char *text;
+    Uint8 r;
+    Uint8 g;
+    Uint8 b;
+    int w;
+    int h;
+    Uint32 lastUse;
+    SDL_Texture *texture;
+    SDL_Surface *surface;
+} TextRun;
+
+typedef struct FontTint_t
+{
+    Uint8 r;
+    Uint8 g;
+    Uint8 b;
+    SDL_Texture *texture;
+    SDL_Surface *surface;
+} FontTint;
+
+typedef struct TextGlyph_t
+{
+    int x;
+    int srcY;
+} TextGlyph;
+
+#define TEXT_BATCH_MAX_QUADS 256
+
+/* Printable characters from '!' to '~' */
+#define ATLAS_MAX_GLYPHS 94
+
+enum ImageId
+{
+    IMAGE_FONT = 0,
+    IMAGE_BACK,
+    IMAGE_SPLASH,
+    IMAGE_COUNT
+};
+
+/* Embedded image being decompressed on a worker thread */
+typedef struct ImageLoad_t
+{
+    const unsigned char *src;
+    size_t size;
+    /* Decompressed blob, surfaces point into it */
+    unsigned char *data;
+    SDL_Surface *surface;
+    SDL_Thread *thread;
+    Uint64 time;
+} ImageLoad;
+
+enum FadeMode
+{
+    FADE_AUTO = 0,
+    FADE_PALETTE,
+    FADE_OVERLAY
+};
+
 typedef struct App_t
 {
     SDL_Window *m_window;
     SDL_Renderer *m_gRenderer;
+    char *m_rendererName;
+    /* Software renderer keeps the frame between presents */
+    SDL_bool m_softwareRenderer;
+    SDL_bool m_vsync;
+
+    /* Direct framebuffer mode: no renderer, everything is blitted to the window surface */
+    SDL_bool m_surfaceMode;
+    SDL_Surface *m_screen;
+    /* Current drawing target in the framebuffer mode */
+    SDL_Surface *m_target;
+    SDL_Rect m_updateRects[16];
+    int m_updateRectsCount;
+    SDL_bool m_updateFull;
+    /* Optional multi-threaded compositing of the window surface */
+    Compositor *m_compositor;
+    /* Drawing is done by a separate thread when set, see render.h */
+    struct RenderThread_t *m_renderThread;
 
     SDL_Texture *m_font;
+    SDL_Surface *m_fontSurface;
+    /* Copies of the font with color tints baked in */
+    FontTint m_fontTints[8];
+    size_t m_fontTintsCount;
 
     SDL_Texture *m_back;
     SDL_Texture *m_splash;
+    /* Font glyphs packed into one texture */
+    SDL_Texture *m_atlas;
+    int m_atlasWidth;
+    int m_atlasHeight;
+    SDL_Rect m_atlasGlyphs[ATLAS_MAX_GLYPHS];
+    int m_atlasGlyphsCount;
+    SDL_Surface *m_backSurface;
+    /* Color-keyed, RLE-encoded */
+    SDL_Surface *m_splashSurface;
+    /* Background and splash pre-composed into one opaque layer */
+    SDL_Texture *m_static;
+    SDL_Surface *m_staticSurface;
+    SDL_Surface *m_faderSurface;
+    /* Indexed copy of the static layer with a merged palette, for palette fade */
+    SDL_Surface *m_staticIndexed;
+    SDL_Color m_staticPalette[256];
+    int m_staticFadeLevel;
+
+    /* Pre-rendered labels, keyed by text and tint */
+    TextRun m_textRuns[16];
+    size_t m_textRunsCount;
+    Uint32 m_textRunsClock;
+
+    /* Text is submitted as a batched geometry instead of per-glyph copies */
+    SDL_bool m_textGeometry;
+    SDL_bool m_textBatchOpen;
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    SDL_Vertex m_textBatchVertices[TEXT_BATCH_MAX_QUADS * 4];
+    int m_textBatchIndices[TEXT_BATCH_MAX_QUADS * 6];
+    int m_textBatchQuads;
+#endif
+
+    ImageLoad m_images[IMAGE_COUNT];
+    /* Config is parsed on a worker thread while SDL initializes */
+    SDL_Thread *m_setupThread;
+    /* Performance counter values for the startup trace */
+    Uint64 m_startupBegin;
+    Uint64 m_startupLast;
+    SDL_bool m_inputDevicesReady;
 
     char *m_windowTitle;
     int m_windowWidth;
@@ -52,34 +174,63 @@ typedef struct App_t
 
     SDL_bool optNoSound;
     SDL_bool optFrameSkip;
+    int optFadeMode;
+    SDL_bool optVSync;
+    /* Compositor threads: 0 is off, less than zero is one per CPU */
+    int optComposeThreads;
+    SDL_bool optRenderThread;
 
     SDL_Event m_event;
     int fadeLevel;
+    /* Duration of fade-in and fade-out in milliseconds */
+    int m_fadeDuration;
 } App;
 
 extern int executeProcess(const char *path, char * const argv[]);
 
 extern void initApp(App *a);
 extern int initSdl(void);
+extern void initInputDevices(App *a);
 extern void quitSdl(App *a);
 extern int isSdlError(void);
 
 extern void loadSetup(App *a);
+extern void startLoadingSetup(App *a);
+extern void waitSetup(App *a);
+extern void logStartupPhase(App *a, const char *phase);
 
+extern void startLoadingImages(App *a);
 extern int initWindow(App *a);
 extern int initFont(App *a);
 
 extern int initTextures(App *a);
+extern int initStaticLayer(App *a);
+extern void resizeWindow(App *a, int w, int h);
+extern void updateStaticLayer(App *a);
+extern void renderStaticLayer(App *a);
+extern void setClipRect(App *a, const SDL_Rect *clip);
+extern void setUpdateRects(App *a, const SDL_Rect *rects, int count);
+extern void presentFrame(App *a);
+extern int fadeTarget(App *a, const SDL_Rect *r, Uint8 level);
+extern SDL_bool isPaletteFade(App *a);
 
 extern void processEvent(Menu *m, App *a);
 extern void waitEvents(Menu *m, App *a);
 extern void doEvents(Menu *m, App *a);
+extern void waitEventsUntil(Menu *m, App *a, Uint64 deadline);
 
 extern void renderTexture(App *app, int xDst, int yDst, int wDst, int hDst,
                           SDL_Texture *t,
                           int xSrc, int ySrc, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
 extern void renderTextureS(App *app, int x, int y, SDL_Texture *t);
+extern void renderSurface(App *app, int xDst, int yDst, int wDst, int hDst,
+                          SDL_Surface *s, int xSrc, int ySrc);
+extern void renderSurfaceS(App *app, int x, int y, SDL_Surface *s);
+extern void beginTextBatch(App *app);
+extern void endTextBatch(App *app);
 extern void printText(App *app, const char *text, int x, int y, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+extern void printTextCached(App *app, const char *text, int x, int y, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+extern void clearTextCache(App *app);
 extern void getTextBlockSize(const char *text, int *w, int *h);
 
 #endif /* APP_H */
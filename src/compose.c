@@ -0,0 +1,369 @@
+/*
+ * X-Tech Launcher - a simple template game launcher
+ *
+ * Copyright (c) 2009-2011 Andrew Spinks, original VB6 code
+ * Copyright (c) 2020-2020 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <SDL2/SDL.h>
+
+#include "compose.h"
+#include "pixops.h"
+
+static void runOp(const ComposeOp *op, SDL_Surface *dst, int y0, int y1)
+{
+    int top = SDL_max(op->dst.y, y0);
+    int bottom = SDL_min(op->dst.y + op->dst.h, y1);
+    Uint8 *d, *s;
+
+    if(top >= bottom)
+        return;
+
+    d = (Uint8 *)dst->pixels + top * dst->pitch + op->dst.x * 4;
+
+    if(op->type == COMPOSE_FADE)
+    {
+        fadePixels32(d, op->dst.w, bottom - top, dst->pitch, op->level);
+        return;
+    }
+
+    s = (Uint8 *)op->src->pixels + (op->srcY + top - op->dst.y) * op->src->pitch + op->srcX * 4;
+    copyPixels32(d, dst->pitch, s, op->src->pitch, op->dst.w, bottom - top,
+                 op->mul, op->key, op->useKey);
+}
+
+static void runTiles(Compositor *c)
+{
+    int tile, y0, y1;
+    size_t i;
+
+    for(;;)
+    {
+        tile = SDL_AtomicAdd(&c->m_nextTile, 1);
+        if(tile >= c->m_tilesCount)
+            break;
+
+        y0 = tile * c->m_tileHeight;
+        y1 = SDL_min(y0 + c->m_tileHeight, c->m_target->h);
+
+        for(i = 0; i < c->m_opsCount; i++)
+            runOp(&c->m_ops[i], c->m_target, y0, y1);
+    }
+}
+
+static int composeWorker(void *data)
+{
+    Compositor *c = (Compositor *)data;
+    int seen = 0;
+
+    SDL_LockMutex(c->m_lock);
+    for(;;)
+    {
+        while(!c->m_quit && c->m_generation == seen)
+            SDL_CondWait(c->m_wake, c->m_lock);
+
+        if(c->m_quit)
+            break;
+
+        seen = c->m_generation;
+        SDL_UnlockMutex(c->m_lock);
+
+        runTiles(c);
+
+        SDL_LockMutex(c->m_lock);
+        if(--c->m_running == 0)
+            SDL_CondSignal(c->m_done);
+    }
+    SDL_UnlockMutex(c->m_lock);
+
+    return 0;
+}
+
+Compositor *createCompositor(int threads)
+{
+    Compositor *c;
+    int i;
+
+    if(threads <= 0)
+        threads = SDL_GetCPUCount();
+    if(threads <= 0)
+        threads = 1;
+
+    c = (Compositor *)SDL_calloc(1, sizeof(Compositor));
+    if(!c)
+        return NULL;
+
+    c->m_lock = SDL_CreateMutex();
+    c->m_wake = SDL_CreateCond();
+    c->m_done = SDL_CreateCond();
+    c->m_threads = (SDL_Thread **)SDL_calloc((size_t)threads, sizeof(SDL_Thread *));
+    if(!c->m_lock || !c->m_wake || !c->m_done || !c->m_threads)
+    {
+        destroyCompositor(c);
+        return NULL;
+    }
+
+    /* The calling thread is the first one */
+    for(i = 1; i < threads; i++)
+    {
+        c->m_threads[i] = SDL_CreateThread(composeWorker, "compose", c);
+        if(!c->m_threads[i])
+        {
+            SDL_Log("Can't start compositor thread: %s", SDL_GetError());
+            break;
+        }
+    }
+
+    c->m_threadsCount = i;
+
+    return c;
+}
+
+void destroyCompositor(Compositor *c)
+{
+    int i;
+    size_t j;
+
+    if(!c)
+        return;
+
+    if(c->m_lock)
+    {
+        SDL_LockMutex(c->m_lock);
+        c->m_quit = SDL_TRUE;
+        SDL_CondBroadcast(c->m_wake);
+        SDL_UnlockMutex(c->m_lock);
+    }
+
+    for(i = 1; i < c->m_threadsCount; i++)
+        SDL_WaitThread(c->m_threads[i], NULL);
+
+    if(c->m_frames > 0)
+    {
+        SDL_Log("Compositor: %d thread(s), %.3f ms per frame over %u frames",
+                c->m_threadsCount,
+                (double)c->m_time * 1000.0 / (double)SDL_GetPerformanceFrequency() / (double)c->m_frames,
+                (unsigned)c->m_frames);
+    }
+
+    for(j = 0; j < c->m_opsCount; j++)
+    {
+        if(c->m_ops[j].src)
+            SDL_FreeSurface(c->m_ops[j].src);
+    }
+
+    SDL_free(c->m_ops);
+    SDL_free(c->m_threads);
+    if(c->m_done)
+        SDL_DestroyCond(c->m_done);
+    if(c->m_wake)
+        SDL_DestroyCond(c->m_wake);
+    if(c->m_lock)
+        SDL_DestroyMutex(c->m_lock);
+    SDL_free(c);
+}
+
+static ComposeOp *addOp(Compositor *c)
+{
+    size_t newCapacity;
+    ComposeOp *ops;
+
+    if(c->m_opsCount == c->m_opsCapacity)
+    {
+        newCapacity = c->m_opsCapacity ? c->m_opsCapacity * 2 : 64;
+        ops = (ComposeOp *)SDL_realloc(c->m_ops, newCapacity * sizeof(ComposeOp));
+        if(!ops)
+            return NULL;
+        c->m_ops = ops;
+        c->m_opsCapacity = newCapacity;
+    }
+
+    return &c->m_ops[c->m_opsCount++];
+}
+
+/* Run the recorded operations, the frame counter is left to composeFlush() */
+static void runOps(Compositor *c, SDL_Surface *dst)
+{
+    Uint64 start;
+    size_t i;
+
+    if(c->m_opsCount == 0)
+        return;
+
+    start = SDL_GetPerformanceCounter();
+
+    if(!SDL_MUSTLOCK(dst) || SDL_LockSurface(dst) == 0)
+    {
+        /* A few tiles per thread to even out the load */
+        c->m_target = dst;
+        c->m_tileHeight = SDL_max(16, (dst->h + c->m_threadsCount * 4 - 1) / (c->m_threadsCount * 4));
+        c->m_tilesCount = (dst->h + c->m_tileHeight - 1) / c->m_tileHeight;
+        SDL_AtomicSet(&c->m_nextTile, 0);
+
+        SDL_LockMutex(c->m_lock);
+        c->m_running = c->m_threadsCount - 1;
+        c->m_generation++;
+        SDL_CondBroadcast(c->m_wake);
+        SDL_UnlockMutex(c->m_lock);
+
+        runTiles(c);
+
+        /* Barrier: every worker has finished its tiles */
+        SDL_LockMutex(c->m_lock);
+        while(c->m_running > 0)
+            SDL_CondWait(c->m_done, c->m_lock);
+        SDL_UnlockMutex(c->m_lock);
+
+        if(SDL_MUSTLOCK(dst))
+            SDL_UnlockSurface(dst);
+    }
+
+    for(i = 0; i < c->m_opsCount; i++)
+    {
+        if(c->m_ops[i].src)
+            SDL_FreeSurface(c->m_ops[i].src);
+    }
+    c->m_opsCount = 0;
+
+    c->m_time += SDL_GetPerformanceCounter() - start;
+}
+
+/*
+ * The kernels only copy opaque pixels of the target format. Without an
+ * alpha channel a blended copy is opaque too.
+ */
+static SDL_bool isPlainCopy(SDL_Surface *dst, SDL_Surface *src)
+{
+    SDL_BlendMode mode;
+    Uint8 alpha;
+
+    if(src->format->format != dst->format->format)
+        return SDL_FALSE;
+
+    SDL_GetSurfaceAlphaMod(src, &alpha);
+    SDL_GetSurfaceBlendMode(src, &mode);
+
+    return (alpha == 255 && (mode == SDL_BLENDMODE_NONE ||
+            (mode == SDL_BLENDMODE_BLEND && !src->format->Amask))) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Let SDL draw what can't be recorded, after the operations recorded before it */
+static void blitNow(Compositor *c, SDL_Surface *dst, SDL_Surface *src,
+                    const SDL_Rect *srcRect, const SDL_Rect *dstRect)
+{
+    SDL_Rect area = *dstRect;
+
+    runOps(c, dst);
+    SDL_BlitSurface(src, srcRect, dst, &area);
+}
+
+void composeCopy(Compositor *c, SDL_Surface *dst, SDL_Surface *src,
+                 const SDL_Rect *srcRect, const SDL_Rect *dstRect)
+{
+    SDL_Rect area, full;
+    ComposeOp *op;
+    Uint8 r, g, b;
+    Uint32 key;
+
+    if(!isPlainCopy(dst, src))
+    {
+        blitNow(c, dst, src, srcRect, dstRect);
+        return;
+    }
+
+    full.x = 0;
+    full.y = 0;
+    full.w = src->w;
+    full.h = src->h;
+    if(!srcRect)
+        srcRect = &full;
+
+    area.x = dstRect->x;
+    area.y = dstRect->y;
+    area.w = srcRect->w;
+    area.h = srcRect->h;
+
+    /* Clip against the target, the same way SDL_BlitSurface() does */
+    if(!SDL_IntersectRect(&area, &dst->clip_rect, &area))
+        return;
+
+    op = addOp(c);
+    if(!op)
+    {
+        blitNow(c, dst, src, srcRect, dstRect);
+        return;
+    }
+
+    op->type = COMPOSE_COPY;
+    op->src = src;
+    op->dst = area;
+    op->srcX = srcRect->x + area.x - dstRect->x;
+    op->srcY = srcRect->y + area.y - dstRect->y;
+    op->level = 255;
+
+    SDL_GetSurfaceColorMod(src, &r, &g, &b);
+    if(r == 255 && g == 255 && b == 255)
+        op->mul = 0xFFFFFFFF;
+    else
+    {
+        op->mul = SDL_MapRGBA(src->format, r, g, b, 255);
+        if(!src->format->Amask)
+            op->mul |= ~(src->format->Rmask | src->format->Gmask | src->format->Bmask);
+    }
+
+    op->useKey = (SDL_GetColorKey(src, &key) == 0) ? SDL_TRUE : SDL_FALSE;
+    op->key = op->useKey ? key : 0;
+
+    /* Keep the source alive until the flush, text runs may be evicted meanwhile */
+    src->refcount++;
+}
+
+void composeFade(Compositor *c, SDL_Surface *dst, const SDL_Rect *rect, Uint8 level)
+{
+    SDL_Rect area;
+    ComposeOp *op;
+
+    if(!SDL_IntersectRect(rect, &dst->clip_rect, &area))
+        return;
+
+    op = addOp(c);
+    if(!op)
+        return;
+
+    op->type = COMPOSE_FADE;
+    op->src = NULL;
+    op->dst = area;
+    op->srcX = 0;
+    op->srcY = 0;
+    op->mul = 0xFFFFFFFF;
+    op->key = 0;
+    op->useKey = SDL_FALSE;
+    op->level = level;
+}
+
+void composeFlush(Compositor *c, SDL_Surface *dst)
+{
+    if(c->m_opsCount == 0)
+        return;
+
+    runOps(c, dst);
+    c->m_frames++;
+}
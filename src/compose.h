@@ -0,0 +1,98 @@
+/*
+ * X-Tech Launcher - a simple template game launcher
+ *
+ * Copyright (c) 2009-2011 Andrew Spinks, original VB6 code
+ * Copyright (c) 2020-2020 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef COMPOSE_H
+#define COMPOSE_H
+
+#include <SDL2/SDL.h>
+
+typedef enum ComposeOpType_t
+{
+    COMPOSE_COPY = 0,
+    COMPOSE_FADE
+} ComposeOpType;
+
+/* Recorded drawing operation, already clipped to the target */
+typedef struct ComposeOp_t
+{
+    ComposeOpType type;
+    SDL_Surface *src;
+    SDL_Rect dst;
+    int srcX;
+    int srcY;
+    /* Per-channel factors in the target format, all bits set for no modulation */
+    Uint32 mul;
+    Uint32 key;
+    SDL_bool useKey;
+    Uint8 level;
+} ComposeOp;
+
+/*
+ * Tile-parallel compositor of the framebuffer mode: drawing is recorded
+ * during the frame, then the target is split into horizontal tiles which
+ * are composited by the worker threads and the calling thread together.
+ * Only the own pixel kernels are used there, SDL blits aren't thread-safe
+ * on shared source surfaces.
+ */
+typedef struct Compositor_t
+{
+    int m_threadsCount;
+    SDL_Thread **m_threads;
+    SDL_mutex *m_lock;
+    SDL_cond *m_wake;
+    SDL_cond *m_done;
+    int m_generation;
+    int m_running;
+    SDL_bool m_quit;
+
+    ComposeOp *m_ops;
+    size_t m_opsCount;
+    size_t m_opsCapacity;
+
+    SDL_Surface *m_target;
+    int m_tileHeight;
+    int m_tilesCount;
+    SDL_atomic_t m_nextTile;
+
+    Uint64 m_time;
+    Uint32 m_frames;
+} Compositor;
+
+/* Threads count includes the calling thread, 0 or less means one per CPU */
+extern Compositor *createCompositor(int threads);
+extern void destroyCompositor(Compositor *c);
+
+/*
+ * Record a surface blit. Copies with an alpha mod, blending or a format
+ * other than the target's are blitted by SDL at once, after a flush.
+ */
+extern void composeCopy(Compositor *c, SDL_Surface *dst, SDL_Surface *src,
+                        const SDL_Rect *srcRect, const SDL_Rect *dstRect);
+extern void composeFade(Compositor *c, SDL_Surface *dst, const SDL_Rect *rect, Uint8 level);
+
+/* Run all recorded operations and wait until every tile is done */
+extern void composeFlush(Compositor *c, SDL_Surface *dst);
+
+#endif /* COMPOSE_H */
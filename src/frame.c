@@ -0,0 +1,86 @@
+/*
+ * X-Tech Launcher - a simple template game launcher
+ *
+ * Copyright (c) 2009-2011 Andrew Spinks, original VB6 code
+ * Copyright (c) 2020-2020 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <SDL2/SDL.h>
+
+#include "frame.h"
+
+void initFrameScheduler(FrameScheduler *f, int fps)
+{
+    if(fps <= 0)
+        fps = 60;
+
+    f->m_freq = SDL_GetPerformanceFrequency();
+    f->m_period = f->m_freq / (Uint64)fps;
+    f->m_nextFrame = SDL_GetPerformanceCounter();
+    f->m_animStart = f->m_nextFrame;
+    f->m_animDuration = 0;
+    f->m_animating = SDL_FALSE;
+}
+
+void startAnimation(FrameScheduler *f, Uint32 durationMs)
+{
+    f->m_animStart = SDL_GetPerformanceCounter();
+    f->m_nextFrame = f->m_animStart;
+    f->m_animDuration = durationMs;
+    f->m_animating = SDL_TRUE;
+}
+
+int animationLevel(FrameScheduler *f)
+{
+    Uint64 elapsed, total;
+
+    if(!f->m_animating)
+        return 255;
+
+    elapsed = SDL_GetPerformanceCounter() - f->m_animStart;
+    total = (f->m_freq * f->m_animDuration) / 1000;
+
+    if(elapsed >= total)
+    {
+        f->m_animating = SDL_FALSE;
+        return 255;
+    }
+
+    return (int)((elapsed * 255) / total);
+}
+
+SDL_bool isAnimating(FrameScheduler *f)
+{
+    return f->m_animating;
+}
+
+Uint64 nextFrameDeadline(FrameScheduler *f)
+{
+    Uint64 now = SDL_GetPerformanceCounter();
+
+    f->m_nextFrame += f->m_period;
+
+    /* Running late: don't try to catch up with a burst of frames */
+    if(f->m_nextFrame < now)
+        f->m_nextFrame = now + f->m_period;
+
+    return f->m_nextFrame;
+}
@@ -0,0 +1,56 @@
+/*
+ * X-Tech Launcher - a simple template game launcher
+ *
+ * Copyright (c) 2009-2011 Andrew Spinks, original VB6 code
+ * Copyright (c) 2020-2020 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FRAME_H
+#define FRAME_H
+
+#include <SDL2/SDL_types.h>
+
+/*
+ * Frame pacing: animations are advanced by the elapsed wall-clock time,
+ * and the time left until the next frame is spent blocked on events.
+ */
+typedef struct FrameScheduler_t
+{
+    Uint64 m_freq;
+    Uint64 m_period;
+    Uint64 m_nextFrame;
+    Uint64 m_animStart;
+    Uint32 m_animDuration;
+    SDL_bool m_animating;
+} FrameScheduler;
+
+extern void initFrameScheduler(FrameScheduler *f, int fps);
+
+/* Start an animation lasting a given number of milliseconds */
+extern void startAnimation(FrameScheduler *f, Uint32 durationMs);
+/* Progress of the current animation in 0...255 range, stops it when it's done */
+extern int animationLevel(FrameScheduler *f);
+extern SDL_bool isAnimating(FrameScheduler *f);
+
+/* Performance counter value of the next frame deadline */
+extern Uint64 nextFrameDeadline(FrameScheduler *f);
+
+#endif /* FRAME_H */
@@ -25,11 +25,16 @@
 
 #include "app.h"
 #include "menu.h"
+#include "frame.h"
+#include "render.h"
 
 int main(int argc, char **argv)
 {
     App a;
     Menu m;
+    FrameScheduler f;
+    RenderThread rt;
+    SDL_bool firstFrame = SDL_TRUE;
     int ret;
 
     (void)argc; (void)argv;
@@ -37,11 +42,23 @@ int main(int argc, char **argv)
     /* Initialize application */
     initApp(&a);
 
-    /* Load settings from INI files */
-    loadSetup(&a);
+    /*
+     * Settings and images are loaded on worker threads while SDL and the
+     * window get initialized, the results are joined where they're needed
+     */
+    startLoadingSetup(&a);
+    startLoadingImages(&a);
 
     if(!initSdl())
+    {
+        quitSdl(&a);
         return 1;
+    }
+    logStartupPhase(&a, "SDL init");
+
+    /* Load settings from INI files */
+    waitSetup(&a);
+    logStartupPhase(&a, "config wait");
 
     ret = initWindow(&a);
     if(ret > 0)
@@ -49,6 +66,7 @@ int main(int argc, char **argv)
         quitSdl(&a);
         return ret;
     }
+    logStartupPhase(&a, "window");
 
     ret = initFont(&a);
     if(ret > 0)
@@ -56,6 +74,7 @@ int main(int argc, char **argv)
         quitSdl(&a);
         return ret;
     }
+    logStartupPhase(&a, "font");
 
     ret = initTextures(&a);
     if(ret > 0)
@@ -63,44 +82,78 @@ int main(int argc, char **argv)
         quitSdl(&a);
         return ret;
     }
+    logStartupPhase(&a, "textures");
+
+    /* Not fatal: without the cache both layers are drawn every frame */
+    initStaticLayer(&a);
 
     initMenu(&m, &a);
+    logStartupPhase(&a, "scene");
 
     a.m_working = 1;
 
-    while(a.fadeLevel < 255)
+    initFrameScheduler(&f, 60);
+
+    startAnimation(&f, (Uint32)a.m_fadeDuration);
+    while(isAnimating(&f))
     {
-        SDL_SetRenderDrawColor(a.m_gRenderer, 255, 255, 255, 255);
-        SDL_RenderClear(a.m_gRenderer);
+        a.fadeLevel = animationLevel(&f);
+        invalidateMenu(&m);
         renderMenu(&m, &a);
         drawFader(&a);
-        SDL_RenderPresent(a.m_gRenderer);
-        doEvents(&m, &a);
-        SDL_Delay(10);
-        a.fadeLevel += 10;
+        presentFrame(&a);
+        if(firstFrame)
+        {
+            logStartupPhase(&a, "first frame");
+            firstFrame = SDL_FALSE;
+            initInputDevices(&a);
+        }
+        if(a.m_vsync)
+            doEvents(&m, &a); /* Present already waited for the display */
+        else if(isAnimating(&f))
+            waitEventsUntil(&m, &a, nextFrameDeadline(&f));
     }
 
     a.fadeLevel = 255;
 
-    while(a.m_working)
+    /* In case the fade-in had no frames */
+    initInputDevices(&a);
+
+    invalidateMenu(&m);
+
+    if(a.optRenderThread && startRenderThread(&rt, &m, &a) == 0)
     {
-        SDL_SetRenderDrawColor(a.m_gRenderer, 255, 255, 255, 255);
-        SDL_RenderClear(a.m_gRenderer);
-        renderMenu(&m, &a);
-        SDL_RenderPresent(a.m_gRenderer);
-        waitEvents(&m, &a);
+        /* Drawing is done by the render thread, actions never wait for a frame */
+        while(a.m_working)
+            waitEvents(&m, &a);
+
+        stopRenderThread(&rt);
+        invalidateMenu(&m);
+    }
+    else
+    {
+        /* Nothing is animated here: block on events until something changes */
+        while(a.m_working)
+        {
+            /* Only damaged regions are re-composited, skip present if nothing changed */
+            if(renderMenu(&m, &a))
+                presentFrame(&a);
+            waitEvents(&m, &a);
+        }
     }
 
-    while(a.fadeLevel > 0)
+    startAnimation(&f, (Uint32)a.m_fadeDuration);
+    while(isAnimating(&f))
     {
-        SDL_SetRenderDrawColor(a.m_gRenderer, 255, 255, 255, 255);
-        SDL_RenderClear(a.m_gRenderer);
+        a.fadeLevel = 255 - animationLevel(&f);
+        invalidateMenu(&m);
         renderMenu(&m, &a);
         drawFader(&a);
-        SDL_RenderPresent(a.m_gRenderer);
-        doEvents(&m, &a);
-        SDL_Delay(10);
-        a.fadeLevel -= 10;
+        presentFrame(&a);
+        if(a.m_vsync)
+            doEvents(&m, &a); /* Present already waited for the display */
+        else if(isAnimating(&f))
+            waitEventsUntil(&m, &a, nextFrameDeadline(&f));
     }
 
     unInitMenu(&m);
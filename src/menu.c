@@ -73,6 +73,71 @@ static void initCheckBox(Menu *m, size_t i, const char *label, int x, int y, SDL
     m->s_cb[i].dstValue = target;
 }
 
+static void setCmd(Menu *m, size_t i, const char *text, int x, int y)
+{
+    MenuDrawCmd *c = &m->s_cmds[i];
+    c->text = text;
+    c->bounds.x = x;
+    c->bounds.y = y;
+    getTextBlockSize(text, &c->bounds.w, &c->bounds.h);
+    c->bounds.w += 1;
+    c->bounds.h += 1;
+    c->r = 255;
+    c->g = 255;
+    c->b = 255;
+}
+
+static void updateItemCmd(Menu *m, MenuItem *it)
+{
+    MenuDrawCmd *c = &m->s_cmds[it->cmd];
+
+    if(it->choosen)
+    {
+        c->r = 255;
+        c->g = 128;
+        c->b = 128;
+    }
+    else
+    {
+        c->r = it->selected ? 128 : 255;
+        c->g = 255;
+        c->b = 255;
+    }
+}
+
+static void updateCheckBoxCmds(Menu *m, MenuCheckBox *it)
+{
+    MenuDrawCmd *mark = &m->s_cmds[it->cmd], *label = &m->s_cmds[it->cmd + 1];
+
+    setCmd(m, it->cmd, it->checkState ? "X" : "-", it->x, it->y);
+    mark->r = it->selected ? 128 : 255;
+    label->r = mark->r;
+}
+
+/* Build the display list once, later it gets patched by the state changes only */
+static void buildDisplayList(Menu *m)
+{
+    size_t i, c = 0;
+
+    for(i = 0; i < m->s_menu_count; i++)
+    {
+        m->s_menu[i].cmd = c;
+        setCmd(m, c++, m->s_menu[i].label, m->s_menu[i].x, m->s_menu[i].y);
+        updateItemCmd(m, &m->s_menu[i]);
+    }
+
+    for(i = 0; i < m->s_cb_count; i++)
+    {
+        m->s_cb[i].cmd = c;
+        c += 2;
+        setCmd(m, m->s_cb[i].cmd + 1, m->s_cb[i].label, m->s_cb[i].x + 20, m->s_cb[i].y);
+        updateCheckBoxCmds(m, &m->s_cb[i]);
+    }
+
+    m->s_cmds_count = c;
+    m->s_drawn_count = 0;
+}
+
 void initMenu(Menu *m, App *a)
 {
     initMenuItem(m, 0, "Start game", 20, 370, startGame);
@@ -84,12 +149,19 @@ void initMenu(Menu *m, App *a)
     initCheckBox(m, 0, "No Sound", 10, 10, &a->optNoSound);
     initCheckBox(m, 1, "Frameskip", 10, 38, &a->optFrameSkip);
     m->s_cb_count = 2;
+
+    m->s_replay = SDL_FALSE;
+
+    buildDisplayList(m);
+    invalidateMenu(m);
 }
 
 void unInitMenu(Menu *m)
 {
     m->s_menu_count = 0;
     m->s_cb_count = 0;
+    m->s_cmds_count = 0;
+    m->s_drawn_count = 0;
 }
 
 SDL_bool checkCollision(MenuItem *it, int x, int y)
@@ -118,50 +190,172 @@ SDL_bool checkCollisionCB(MenuCheckBox *it, int x, int y)
     return SDL_TRUE;
 }
 
+void invalidateMenu(Menu *m)
+{
+    m->s_dirty_count = 0;
+    m->s_dirty_full = SDL_TRUE;
+}
+
+static void markDirty(Menu *m, int x, int y, int w, int h)
+{
+    SDL_Rect *r;
+
+    if(m->s_dirty_full)
+        return;
+
+    if(m->s_dirty_count >= SDL_arraysize(m->s_dirty))
+    {
+        invalidateMenu(m);
+        return;
+    }
+
+    r = &m->s_dirty[m->s_dirty_count++];
+    r->x = x;
+    r->y = y;
+    r->w = w + 1;
+    r->h = h + 1;
+}
+
+static SDL_bool isSameCmd(const MenuDrawCmd *a, const MenuDrawCmd *b)
+{
+    return (a->text == b->text && SDL_RectEquals(&a->bounds, &b->bounds) &&
+            a->r == b->r && a->g == b->g && a->b == b->b) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Damage the bounds of every command changed since the last drawn frame */
+static void diffDisplayList(Menu *m)
+{
+    size_t i;
+    const MenuDrawCmd *c, *d;
+
+    if(m->s_drawn_count != m->s_cmds_count)
+        invalidateMenu(m);
+
+    for(i = 0; i < m->s_cmds_count && !m->s_dirty_full; i++)
+    {
+        c = &m->s_cmds[i];
+        d = &m->s_drawn[i];
+        if(isSameCmd(c, d))
+            continue;
+        markDirty(m, c->bounds.x, c->bounds.y, c->bounds.w - 1, c->bounds.h - 1);
+        if(!SDL_RectEquals(&c->bounds, &d->bounds))
+            markDirty(m, d->bounds.x, d->bounds.y, d->bounds.w - 1, d->bounds.h - 1);
+    }
+
+    SDL_memcpy(m->s_drawn, m->s_cmds, m->s_cmds_count * sizeof(MenuDrawCmd));
+    m->s_drawn_count = m->s_cmds_count;
+}
+
+static void setItemSelected(Menu *m, MenuItem *it, SDL_bool selected)
+{
+    if(it->selected == selected)
+        return;
+    it->selected = selected;
+    updateItemCmd(m, it);
+}
+
+static void setCheckBoxSelected(Menu *m, MenuCheckBox *it, SDL_bool selected)
+{
+    if(it->selected == selected)
+        return;
+    it->selected = selected;
+    updateCheckBoxCmds(m, it);
+}
+
 void drawFader(App *a)
 {
     SDL_Rect r;
+
+    /* Palette fade is already applied to the static layer and labels */
+    if(isPaletteFade(a))
+        return;
+
     r.x = 0;
     r.y = 0;
     r.w = a->m_windowWidth;
     r.h = a->m_windowHeight;
+
+    if(a->m_surfaceMode)
+    {
+        /* Scale the framebuffer in place, blend a black surface on non-32-bit screens */
+        if(fadeTarget(a, &r, (Uint8)a->fadeLevel) != 0 && a->m_faderSurface)
+        {
+            SDL_SetSurfaceAlphaMod(a->m_faderSurface, (255 - (Uint8)a->fadeLevel));
+            SDL_BlitSurface(a->m_faderSurface, NULL, a->m_target, &r);
+        }
+        return;
+    }
+
     SDL_SetRenderDrawColor(a->m_gRenderer, 0, 0, 0, (255 - (Uint8)a->fadeLevel));
     SDL_RenderFillRect(a->m_gRenderer, &r);
 }
 
-void renderMenu(Menu *m, App *app)
+static void renderMenuRegion(Menu *m, App *app, const SDL_Rect *clip)
 {
     size_t i;
-    Uint8 r = 255, g = 255, b = 255, a = 255;
+    const MenuDrawCmd *c;
 
-    /* Background */
-    renderTextureS(app, 0, 0, app->m_back);
-    /* Splash logo */
-    renderTextureS(app, 50, 80, app->m_splash);
+    setClipRect(app, clip);
 
-    /* Menu items */
-    for(i = 0; i < m->s_menu_count; i++)
+    /* Background and splash logo */
+    renderStaticLayer(app);
+
+    beginTextBatch(app);
+
+    /* Menu items and check boxes */
+    for(i = 0; i < m->s_cmds_count; i++)
     {
-        if(m->s_menu[i].choosen)
-        {
-            g = 128;
-            b = 128;
-        }
-        else
-        {
-            g = 255;
-            b = 255;
-            r = m->s_menu[i].selected ? 128 : 255;
-        }
-        printText(app, m->s_menu[i].label, m->s_menu[i].x, m->s_menu[i].y, r, g, b, a);
+        c = &m->s_cmds[i];
+        if(SDL_HasIntersection(&c->bounds, clip))
+            printTextCached(app, c->text, c->bounds.x, c->bounds.y, c->r, c->g, c->b, 255);
     }
 
-    for(i = 0; i < m->s_cb_count; i++)
+    endTextBatch(app);
+
+    setClipRect(app, NULL);
+}
+
+/*
+ * Re-composite damaged regions only. The display list is diffed against
+ * the last drawn one to find them. Returns SDL_FALSE when nothing has
+ * changed since the last call, so the caller can skip presenting the frame.
+ * The software renderer keeps its backbuffer between presents, so anything
+ * outside of damaged regions is still valid from the previous frame, other
+ * renderers get the whole frame redrawn.
+ */
+SDL_bool renderMenu(Menu *m, App *app)
+{
+    size_t i;
+    SDL_Rect full;
+
+    diffDisplayList(m);
+
+    /* Backbuffer content is undefined after present on other renderers */
+    if(!app->m_softwareRenderer && m->s_dirty_count > 0)
+        invalidateMenu(m);
+
+    if(m->s_dirty_full)
+    {
+        full.x = 0;
+        full.y = 0;
+        full.w = app->m_windowWidth;
+        full.h = app->m_windowHeight;
+        renderMenuRegion(m, app, &full);
+        setUpdateRects(app, NULL, 0);
+    }
+    else if(m->s_dirty_count > 0)
     {
-        r = m->s_cb[i].selected ? 128 : 255;
-        printText(app, m->s_cb[i].checkState ? "X" : "-", m->s_cb[i].x, m->s_cb[i].y, r, g, b, a);
-        printText(app, m->s_cb[i].label, m->s_cb[i].x + 20, m->s_cb[i].y, r, g, b, a);
+        for(i = 0; i < m->s_dirty_count; i++)
+            renderMenuRegion(m, app, &m->s_dirty[i]);
+        setUpdateRects(app, m->s_dirty, (int)m->s_dirty_count);
     }
+    else
+        return SDL_FALSE;
+
+    m->s_dirty_full = SDL_FALSE;
+    m->s_dirty_count = 0;
+
+    return SDL_TRUE;
 }
 
 void processMenuMouseMove(Menu *m, int x, int y)
@@ -170,13 +364,14 @@ void processMenuMouseMove(Menu *m, int x, int y)
     m->s_menu_keypos = -1;
     for(i = 0; i < m->s_menu_count; i++)
     {
-        m->s_menu[i].selected = checkCollision(&m->s_menu[i], x, y);
-        m->s_menu_keypos = (int)i;
+        setItemSelected(m, &m->s_menu[i], checkCollision(&m->s_menu[i], x, y));
+        if(m->s_menu[i].selected)
+            m->s_menu_keypos = (int)i;
     }
 
     for(i = 0; i < m->s_cb_count; i++)
     {
-        m->s_cb[i].selected = checkCollisionCB(&m->s_cb[i], x, y);
+        setCheckBoxSelected(m, &m->s_cb[i], checkCollisionCB(&m->s_cb[i], x, y));
     }
 }
 
@@ -187,9 +382,13 @@ void processMenuMousePress(Menu *m, App *a, int x, int y)
     {
         if(checkCollision(&m->s_menu[i], x, y))
         {
-            m->s_menu[i].action(a);
+            if(!m->s_replay)
+            {
+                m->s_menu[i].action(a);
+                a->m_working = 0;
+            }
             m->s_menu[i].choosen = SDL_TRUE;
-            a->m_working = 0;
+            updateItemCmd(m, &m->s_menu[i]);
             break;
         }
     }
@@ -199,7 +398,9 @@ void processMenuMousePress(Menu *m, App *a, int x, int y)
         if(checkCollisionCB(&m->s_cb[i], x, y))
         {
             m->s_cb[i].checkState = !m->s_cb[i].checkState;
-            *(m->s_cb[i].dstValue) = m->s_cb[i].checkState;
+            if(!m->s_replay)
+                *(m->s_cb[i].dstValue) = m->s_cb[i].checkState;
+            updateCheckBoxCmds(m, &m->s_cb[i]);
             break;
         }
     }
@@ -209,7 +410,7 @@ void processMenuKeyboard(Menu *m, App *a, int key)
 {
     size_t i;
     for(i = 0; i < m->s_menu_count; i++)
-        m->s_menu[m->s_menu_keypos].selected = SDL_FALSE;
+        setItemSelected(m, &m->s_menu[i], SDL_FALSE);
 
     switch(key)
     {
@@ -222,7 +423,7 @@ void processMenuKeyboard(Menu *m, App *a, int key)
             if(m->s_menu_keypos >= (int)m->s_menu_count)
                 m->s_menu_keypos = 0;
         }
-        m->s_menu[m->s_menu_keypos].selected = SDL_TRUE;
+        setItemSelected(m, &m->s_menu[m->s_menu_keypos], SDL_TRUE);
         break;
 
     case SDL_SCANCODE_UP:
@@ -234,21 +435,26 @@ void processMenuKeyboard(Menu *m, App *a, int key)
             if(m->s_menu_keypos < 0)
                 m->s_menu_keypos = (int)(m->s_menu_count - 1);
         }
-        m->s_menu[m->s_menu_keypos].selected = SDL_TRUE;
+        setItemSelected(m, &m->s_menu[m->s_menu_keypos], SDL_TRUE);
         break;
 
     case SDL_SCANCODE_RETURN:
     case SDL_SCANCODE_KP_ENTER:
         if(m->s_menu_keypos >= 0 && m->s_menu_keypos < (int)m->s_menu_count)
         {
-            m->s_menu[m->s_menu_keypos].action(a);
+            if(!m->s_replay)
+            {
+                m->s_menu[m->s_menu_keypos].action(a);
+                a->m_working = 0;
+            }
             m->s_menu[m->s_menu_keypos].choosen = SDL_TRUE;
-            a->m_working = 0;
+            updateItemCmd(m, &m->s_menu[m->s_menu_keypos]);
         }
         break;
 
     case SDL_SCANCODE_ESCAPE:
-        a->m_working = 0;
+        if(!m->s_replay)
+            a->m_working = 0;
         break;
     }
 }
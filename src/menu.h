@@ -28,12 +28,23 @@
 
 #include <stddef.h>
 #include <SDL2/SDL_types.h>
+#include <SDL2/SDL_rect.h>
 
 struct App_t;
 typedef struct App_t App;
 
 typedef void (*MenuAction)(App *a);
 
+/* Retained draw command: a text label with its bounds and tint */
+typedef struct MenuDrawCmd_t
+{
+    const char *text;
+    SDL_Rect bounds;
+    Uint8 r;
+    Uint8 g;
+    Uint8 b;
+} MenuDrawCmd;
+
 typedef struct MenuItem_t
 {
     const char *label;
@@ -44,6 +55,8 @@ typedef struct MenuItem_t
     SDL_bool selected;
     SDL_bool choosen;
     MenuAction action;
+    /* Index of the label command in the display list */
+    size_t cmd;
 } MenuItem;
 
 typedef struct MenuCheckBox_t
@@ -56,6 +69,8 @@ typedef struct MenuCheckBox_t
     SDL_bool selected;
     SDL_bool checkState;
     SDL_bool *dstValue;
+    /* Index of the check mark command, the label one follows it */
+    size_t cmd;
 } MenuCheckBox;
 
 typedef struct Menu_t
@@ -67,12 +82,28 @@ typedef struct Menu_t
 
     MenuCheckBox s_cb[5];
     size_t s_cb_count;
+
+    /* Display list, patched when an item changes its state */
+    MenuDrawCmd s_cmds[16];
+    size_t s_cmds_count;
+    /* Display list as it was drawn last time, for diffing */
+    MenuDrawCmd s_drawn[16];
+    size_t s_drawn_count;
+
+    /* Damaged regions to re-composite on the next renderMenu() call */
+    SDL_Rect s_dirty[16];
+    size_t s_dirty_count;
+    SDL_bool s_dirty_full;
+
+    /* Visual-only copy: input changes the look, but runs no actions */
+    SDL_bool s_replay;
 } Menu;
 
 void initMenu(Menu *m, App *a);
 void unInitMenu(Menu *m);
+void invalidateMenu(Menu *m);
 void drawFader(App *a);
-void renderMenu(Menu *m, App *app);
+SDL_bool renderMenu(Menu *m, App *app);
 void processMenuMouseMove(Menu *m, int x, int y);
 void processMenuMousePress(Menu *m, App *a, int x, int y);
 void processMenuKeyboard(Menu *m, App *a, int key);
@@ -0,0 +1,308 @@
+/*
+ * X-Tech Launcher - a simple template game launcher
+ *
+ * Copyright (c) 2009-2011 Andrew Spinks, original VB6 code
+ * Copyright (c) 2020-2020 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <SDL2/SDL.h>
+
+#include "pixops.h"
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#   define PIXOPS_X86
+#   define PIXOPS_TARGET(x) __attribute__((target(x)))
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#   define PIXOPS_X86
+#   define PIXOPS_TARGET(x)
+#endif
+
+#ifdef PIXOPS_X86
+#include <immintrin.h>
+#endif
+
+typedef void (*ModulateRowFunc)(Uint32 *p, int n, Uint32 mul, Uint32 key, int useKey);
+
+static ModulateRowFunc s_modulateRow = NULL;
+static const char *s_kernelsName = "scalar";
+
+/* Rounded a * b / 255 */
+static Uint32 mul8(Uint32 a, Uint32 b)
+{
+    Uint32 t = a * b + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+static void modulateRowScalar(Uint32 *p, int n, Uint32 mul, Uint32 key, int useKey)
+{
+    int i;
+    Uint32 px;
+
+    for(i = 0; i < n; i++)
+    {
+        px = p[i];
+        if(useKey && px == key)
+            continue;
+
+        p[i] = mul8(px & 0xFF, mul & 0xFF) |
+               (mul8((px >> 8) & 0xFF, (mul >> 8) & 0xFF) << 8) |
+               (mul8((px >> 16) & 0xFF, (mul >> 16) & 0xFF) << 16) |
+               (mul8(px >> 24, mul >> 24) << 24);
+    }
+}
+
+#ifdef PIXOPS_X86
+PIXOPS_TARGET("sse2")
+static void modulateRowSSE2(Uint32 *p, int n, Uint32 mul, Uint32 key, int useKey)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i m = _mm_unpacklo_epi8(_mm_set1_epi32((int)mul), zero);
+    __m128i bias = _mm_set1_epi16(128);
+    __m128i k = _mm_set1_epi32((int)key);
+    __m128i keyMask = _mm_set1_epi32(useKey ? -1 : 0);
+    __m128i px, lo, hi, keep;
+    int i;
+
+    for(i = 0; i + 4 <= n; i += 4)
+    {
+        px = _mm_loadu_si128((const __m128i *)(p + i));
+
+        /* Widen to 16 bits, multiply and divide by 255 with rounding */
+        lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(px, zero), m), bias);
+        hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(px, zero), m), bias);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+
+        keep = _mm_and_si128(_mm_cmpeq_epi32(px, k), keyMask);
+        px = _mm_or_si128(_mm_and_si128(keep, px), _mm_andnot_si128(keep, _mm_packus_epi16(lo, hi)));
+        _mm_storeu_si128((__m128i *)(p + i), px);
+    }
+
+    modulateRowScalar(p + i, n - i, mul, key, useKey);
+}
+
+PIXOPS_TARGET("avx2")
+static void modulateRowAVX2(Uint32 *p, int n, Uint32 mul, Uint32 key, int useKey)
+{
+    __m256i zero = _mm256_setzero_si256();
+    __m256i m = _mm256_unpacklo_epi8(_mm256_set1_epi32((int)mul), zero);
+    __m256i bias = _mm256_set1_epi16(128);
+    __m256i k = _mm256_set1_epi32((int)key);
+    __m256i keyMask = _mm256_set1_epi32(useKey ? -1 : 0);
+    __m256i px, lo, hi, keep;
+    int i;
+
+    /* Unpack and pack work within 128-bit lanes, so the pixel order is kept */
+    for(i = 0; i + 8 <= n; i += 8)
+    {
+        px = _mm256_loadu_si256((const __m256i *)(p + i));
+
+        lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(px, zero), m), bias);
+        hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(px, zero), m), bias);
+        lo = _mm256_srli_epi16(_mm256_add_epi16(lo, _mm256_srli_epi16(lo, 8)), 8);
+        hi = _mm256_srli_epi16(_mm256_add_epi16(hi, _mm256_srli_epi16(hi, 8)), 8);
+
+        keep = _mm256_and_si256(_mm256_cmpeq_epi32(px, k), keyMask);
+        px = _mm256_blendv_epi8(_mm256_packus_epi16(lo, hi), px, keep);
+        _mm256_storeu_si256((__m256i *)(p + i), px);
+    }
+
+    modulateRowScalar(p + i, n - i, mul, key, useKey);
+}
+#endif
+
+void initPixelKernels(void)
+{
+    s_modulateRow = modulateRowScalar;
+    s_kernelsName = "scalar";
+
+#ifdef PIXOPS_X86
+    if(SDL_HasAVX2())
+    {
+        s_modulateRow = modulateRowAVX2;
+        s_kernelsName = "AVX2";
+    }
+    else if(SDL_HasSSE2())
+    {
+        s_modulateRow = modulateRowSSE2;
+        s_kernelsName = "SSE2";
+    }
+#endif
+}
+
+int usePixelKernels(const char *name)
+{
+    if(SDL_strcasecmp(name, "scalar") == 0)
+    {
+        s_modulateRow = modulateRowScalar;
+        s_kernelsName = "scalar";
+        return 0;
+    }
+
+#ifdef PIXOPS_X86
+    if(SDL_strcasecmp(name, "AVX2") == 0 && SDL_HasAVX2())
+    {
+        s_modulateRow = modulateRowAVX2;
+        s_kernelsName = "AVX2";
+        return 0;
+    }
+
+    if(SDL_strcasecmp(name, "SSE2") == 0 && SDL_HasSSE2())
+    {
+        s_modulateRow = modulateRowSSE2;
+        s_kernelsName = "SSE2";
+        return 0;
+    }
+#endif
+
+    return 1;
+}
+
+const char *pixelKernelsName(void)
+{
+    return s_kernelsName;
+}
+
+static void modulatePixels32(void *pixels, int w, int h, int pitch, Uint32 mul, Uint32 key, int useKey)
+{
+    Uint8 *row = (Uint8 *)pixels;
+    int y;
+
+    if(!s_modulateRow)
+        initPixelKernels();
+
+    for(y = 0; y < h; y++, row += pitch)
+        s_modulateRow((Uint32 *)row, w, mul, key, useKey);
+}
+
+void fadePixels32(void *pixels, int w, int h, int pitch, Uint8 level)
+{
+    modulatePixels32(pixels, w, h, pitch, (Uint32)level * 0x01010101u, 0, 0);
+}
+
+void tintPixels32(void *pixels, int w, int h, int pitch, Uint32 mul, Uint32 key)
+{
+    modulatePixels32(pixels, w, h, pitch, mul, key, 1);
+}
+
+void copyPixels32(void *dst, int dstPitch, const void *src, int srcPitch,
+                  int w, int h, Uint32 mul, Uint32 key, int useKey)
+{
+    Uint32 chunk[64];
+    Uint8 *drow = (Uint8 *)dst;
+    const Uint8 *srow = (const Uint8 *)src;
+    const Uint32 *s;
+    Uint32 *d;
+    int x, y, i, n;
+
+    if(!s_modulateRow)
+        initPixelKernels();
+
+    for(y = 0; y < h; y++, drow += dstPitch, srow += srcPitch)
+    {
+        if(mul == 0xFFFFFFFF && !useKey)
+        {
+            SDL_memcpy(drow, srow, (size_t)w * 4);
+            continue;
+        }
+
+        for(x = 0; x < w; x += n)
+        {
+            n = SDL_min(w - x, (int)SDL_arraysize(chunk));
+            s = (const Uint32 *)srow + x;
+            d = (Uint32 *)drow + x;
+
+            if(mul != 0xFFFFFFFF)
+            {
+                /* Modulate a chunk on the stack, key pixels are left intact */
+                SDL_memcpy(chunk, s, (size_t)n * 4);
+                s_modulateRow(chunk, n, mul, key, useKey);
+                s = chunk;
+            }
+
+            if(!useKey)
+            {
+                SDL_memcpy(d, s, (size_t)n * 4);
+                continue;
+            }
+
+            for(i = 0; i < n; i++)
+            {
+                if(s[i] != key)
+                    d[i] = s[i];
+            }
+        }
+    }
+}
+
+int fadeSurface(SDL_Surface *s, const SDL_Rect *r, Uint8 level)
+{
+    SDL_Rect all, area;
+    Uint8 *pixels;
+
+    if(s->format->BytesPerPixel != 4)
+        return 1;
+
+    all.x = 0;
+    all.y = 0;
+    all.w = s->w;
+    all.h = s->h;
+    if(!r)
+        area = all;
+    else if(!SDL_IntersectRect(r, &all, &area))
+        return 0;
+
+    if(SDL_MUSTLOCK(s) && SDL_LockSurface(s) < 0)
+        return 1;
+
+    pixels = (Uint8 *)s->pixels + area.y * s->pitch + area.x * 4;
+    fadePixels32(pixels, area.w, area.h, s->pitch, level);
+
+    if(SDL_MUSTLOCK(s))
+        SDL_UnlockSurface(s);
+
+    return 0;
+}
+
+int tintSurface(SDL_Surface *s, Uint8 r, Uint8 g, Uint8 b)
+{
+    Uint32 key = 0, mul;
+    int useKey;
+
+    if(s->format->BytesPerPixel != 4)
+        return 1;
+
+    useKey = (SDL_GetColorKey(s, &key) == 0);
+    mul = SDL_MapRGBA(s->format, r, g, b, 255);
+    /* Formats without alpha leave the padding byte zero, the factor for it doesn't matter */
+    if(!s->format->Amask)
+        mul |= ~(s->format->Rmask | s->format->Gmask | s->format->Bmask);
+
+    if(SDL_MUSTLOCK(s) && SDL_LockSurface(s) < 0)
+        return 1;
+
+    modulatePixels32(s->pixels, s->w, s->h, s->pitch, mul, key, useKey);
+
+    if(SDL_MUSTLOCK(s))
+        SDL_UnlockSurface(s);
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+/*
+ * X-Tech Launcher - a simple template game launcher
+ *
+ * Copyright (c) 2009-2011 Andrew Spinks, original VB6 code
+ * Copyright (c) 2020-2020 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef PIXOPS_H
+#define PIXOPS_H
+
+#include <SDL2/SDL_types.h>
+
+struct SDL_Surface;
+struct SDL_Rect;
+
+/*
+ * Per-pixel kernels of the framebuffer mode: SSE2 and AVX2 variants are
+ * picked at runtime, the plain C variant is used everywhere else.
+ */
+extern void initPixelKernels(void);
+extern const char *pixelKernelsName(void);
+/* Force a variant by name: "scalar", "SSE2" or "AVX2", non-zero if the CPU can't run it */
+extern int usePixelKernels(const char *name);
+
+/* Scale all channels of 32-bit pixels by level/255 */
+extern void fadePixels32(void *pixels, int w, int h, int pitch, Uint8 level);
+/* Multiply 32-bit pixels by the per-channel factors in mul, pixels equal to the key are kept */
+extern void tintPixels32(void *pixels, int w, int h, int pitch, Uint32 mul, Uint32 key);
+/*
+ * Copy 32-bit pixels multiplied by mul (all bits set for a plain copy),
+ * source pixels equal to the key are skipped when useKey is set
+ */
+extern void copyPixels32(void *dst, int dstPitch, const void *src, int srcPitch,
+                         int w, int h, Uint32 mul, Uint32 key, int useKey);
+
+/* Surface wrappers, return non-zero when the surface isn't 32-bit */
+extern int fadeSurface(struct SDL_Surface *s, const struct SDL_Rect *r, Uint8 level);
+extern int tintSurface(struct SDL_Surface *s, Uint8 r, Uint8 g, Uint8 b);
+
+#endif /* PIXOPS_H */
@@ -0,0 +1,341 @@
+/*
+ * X-Tech Launcher - a simple template game launcher
+ *
+ * Copyright (c) 2009-2011 Andrew Spinks, original VB6 code
+ * Copyright (c) 2020-2020 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <SDL2/SDL.h>
+
+#include "app.h"
+#include "render.h"
+
+#define INPUT_QUEUE_MASK ((int)SDL_arraysize(((InputQueue *)0)->m_items) - 1)
+
+/*
+ * SDL_AtomicSet() is only an acquire barrier on GCC, so the explicit barriers
+ * publish the record before the index and read it only after seeing the index
+ */
+static SDL_bool pushInput(InputQueue *q, const MenuInput *in)
+{
+    int head = SDL_AtomicGet(&q->m_head);
+    int next = (head + 1) & INPUT_QUEUE_MASK;
+
+    if(next == SDL_AtomicGet(&q->m_tail))
+        return SDL_FALSE;
+    SDL_MemoryBarrierAcquire();
+
+    q->m_items[head] = *in;
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&q->m_head, next);
+
+    return SDL_TRUE;
+}
+
+static SDL_bool popInput(InputQueue *q, MenuInput *out)
+{
+    int tail = SDL_AtomicGet(&q->m_tail);
+
+    if(tail == SDL_AtomicGet(&q->m_head))
+        return SDL_FALSE;
+    SDL_MemoryBarrierAcquire();
+
+    *out = q->m_items[tail];
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&q->m_tail, (tail + 1) & INPUT_QUEUE_MASK);
+
+    return SDL_TRUE;
+}
+
+void pushMenuInput(RenderThread *r, int type, int x, int y)
+{
+    MenuInput in;
+
+    in.type = type;
+    in.x = x;
+    in.y = y;
+
+    while(!pushInput(&r->m_queue, &in))
+    {
+        /* Hover gets refreshed by the next motion anyway */
+        if(type == INPUT_MOTION)
+            return;
+        SDL_Delay(1);
+    }
+
+    SDL_SemPost(r->m_wake);
+}
+
+/* Back buffer in the window surface format, replaced by the render thread on resize */
+static int resizeBackBuffer(RenderThread *r, int w, int h)
+{
+    App *a = r->m_app;
+    Uint32 format = a->m_screen->format->format;
+    SDL_Surface *back;
+
+    back = SDL_CreateRGBSurfaceWithFormat(0, w, h, SDL_BITSPERPIXEL(format), format);
+    if(!back)
+    {
+        SDL_Log("Can't create render thread back buffer: %s", SDL_GetError());
+        return 1;
+    }
+
+    SDL_SetSurfaceBlendMode(back, SDL_BLENDMODE_NONE);
+
+    /* Every draw call and the compositor target the back buffer */
+    a->m_windowWidth = w;
+    a->m_windowHeight = h;
+    a->m_screen = back;
+    a->m_target = back;
+    if(r->m_back)
+        SDL_FreeSurface(r->m_back);
+    r->m_back = back;
+
+    initStaticLayer(a);
+
+    return 0;
+}
+
+/* Hand the frame over to the main thread, damage of frames not presented yet adds up */
+static void publishFrame(RenderThread *r)
+{
+    App *a = r->m_app;
+    SDL_Event e;
+    int i;
+
+    if(a->m_compositor)
+        composeFlush(a->m_compositor, r->m_back);
+
+    if(a->m_updateFull ||
+       r->m_presentRectsCount + a->m_updateRectsCount > (int)SDL_arraysize(r->m_presentRects))
+        r->m_presentFull = SDL_TRUE;
+    else
+    {
+        for(i = 0; i < a->m_updateRectsCount; i++)
+            r->m_presentRects[r->m_presentRectsCount++] = a->m_updateRects[i];
+    }
+
+    a->m_updateRectsCount = 0;
+    a->m_updateFull = SDL_FALSE;
+
+    if(!r->m_presentPending && (r->m_presentFull || r->m_presentRectsCount > 0))
+    {
+        r->m_presentPending = SDL_TRUE;
+        SDL_zero(e);
+        e.type = r->m_presentEvent;
+        SDL_PushEvent(&e);
+    }
+}
+
+SDL_bool handleRenderEvent(RenderThread *r, const SDL_Event *e)
+{
+    App *a = r->m_app;
+    SDL_Surface *screen;
+    SDL_Rect dst;
+    int i;
+
+    if(e->type != r->m_presentEvent)
+        return SDL_FALSE;
+
+    SDL_LockMutex(r->m_frameLock);
+
+    screen = SDL_GetWindowSurface(a->m_window);
+
+    /* During a resize the frame of the new size follows, skip this one */
+    if(screen && screen->w == r->m_back->w && screen->h == r->m_back->h)
+    {
+        if(r->m_presentFull)
+        {
+            SDL_BlitSurface(r->m_back, NULL, screen, NULL);
+            SDL_UpdateWindowSurface(a->m_window);
+        }
+        else
+        {
+            for(i = 0; i < r->m_presentRectsCount; i++)
+            {
+                dst = r->m_presentRects[i];
+                SDL_BlitSurface(r->m_back, &r->m_presentRects[i], screen, &dst);
+            }
+            SDL_UpdateWindowSurfaceRects(a->m_window, r->m_presentRects, r->m_presentRectsCount);
+        }
+    }
+
+    r->m_presentRectsCount = 0;
+    r->m_presentFull = SDL_FALSE;
+    r->m_presentPending = SDL_FALSE;
+
+    SDL_UnlockMutex(r->m_frameLock);
+
+    return SDL_TRUE;
+}
+
+static SDL_bool applyInput(RenderThread *r, const MenuInput *in)
+{
+    Menu *m = &r->m_menu;
+    App *a = r->m_app;
+
+    switch(in->type)
+    {
+    case INPUT_MOTION:
+        processMenuMouseMove(m, in->x, in->y);
+        break;
+
+    case INPUT_CLICK:
+        processMenuMousePress(m, a, in->x, in->y);
+        break;
+
+    case INPUT_KEY:
+        processMenuKeyboard(m, a, in->x);
+        break;
+
+    case INPUT_RESIZE:
+        resizeBackBuffer(r, in->x, in->y);
+        invalidateMenu(m);
+        break;
+
+    case INPUT_EXPOSE:
+        invalidateMenu(m);
+        break;
+
+    case INPUT_QUIT:
+        return SDL_FALSE;
+    }
+
+    return SDL_TRUE;
+}
+
+static int renderThread(void *data)
+{
+    RenderThread *r = (RenderThread *)data;
+    MenuInput in;
+    SDL_bool working = SDL_TRUE;
+
+    while(working)
+    {
+        SDL_SemWait(r->m_wake);
+
+        SDL_LockMutex(r->m_frameLock);
+
+        /* Drain everything queued so far and draw only the latest state */
+        while(popInput(&r->m_queue, &in))
+        {
+            if(!applyInput(r, &in))
+                working = SDL_FALSE;
+        }
+
+        if(working && renderMenu(&r->m_menu, r->m_app))
+            publishFrame(r);
+
+        SDL_UnlockMutex(r->m_frameLock);
+    }
+
+    return 0;
+}
+
+int startRenderThread(RenderThread *r, Menu *m, App *a)
+{
+    /* The config asked for the framebuffer mode, but it may have fallen back to a renderer */
+    if(!a->m_surfaceMode)
+    {
+        SDL_Log("Render thread: no window surface, drawing on the main thread");
+        return 1;
+    }
+
+    SDL_AtomicSet(&r->m_queue.m_head, 0);
+    SDL_AtomicSet(&r->m_queue.m_tail, 0);
+    r->m_app = a;
+    r->m_back = NULL;
+    r->m_presentRectsCount = 0;
+    r->m_presentFull = SDL_FALSE;
+    r->m_presentPending = SDL_FALSE;
+
+    r->m_presentEvent = SDL_RegisterEvents(1);
+    if(r->m_presentEvent == (Uint32)-1)
+    {
+        SDL_Log("Can't register render thread event: %s", SDL_GetError());
+        return 1;
+    }
+
+    /* Render side replays the input on a copy, actions stay on the main thread */
+    r->m_menu = *m;
+    r->m_menu.s_replay = SDL_TRUE;
+    invalidateMenu(&r->m_menu);
+
+    r->m_wake = SDL_CreateSemaphore(1);
+    r->m_frameLock = SDL_CreateMutex();
+    if(!r->m_wake || !r->m_frameLock)
+    {
+        SDL_Log("Can't create render thread locks: %s", SDL_GetError());
+        if(r->m_wake)
+            SDL_DestroySemaphore(r->m_wake);
+        if(r->m_frameLock)
+            SDL_DestroyMutex(r->m_frameLock);
+        r->m_wake = NULL;
+        r->m_frameLock = NULL;
+        return 1;
+    }
+
+    /* No other thread draws yet, so the back buffer is set up here */
+    if(resizeBackBuffer(r, a->m_windowWidth, a->m_windowHeight) != 0)
+    {
+        SDL_DestroySemaphore(r->m_wake);
+        SDL_DestroyMutex(r->m_frameLock);
+        r->m_wake = NULL;
+        r->m_frameLock = NULL;
+        return 1;
+    }
+
+    r->m_thread = SDL_CreateThread(renderThread, "render", r);
+    if(!r->m_thread)
+    {
+        SDL_Log("Can't start render thread: %s", SDL_GetError());
+        stopRenderThread(r);
+        return 1;
+    }
+
+    a->m_renderThread = r;
+
+    return 0;
+}
+
+void stopRenderThread(RenderThread *r)
+{
+    App *a = r->m_app;
+
+    if(r->m_thread)
+    {
+        pushMenuInput(r, INPUT_QUIT, 0, 0);
+        SDL_WaitThread(r->m_thread, NULL);
+        r->m_thread = NULL;
+    }
+    a->m_renderThread = NULL;
+
+    /* Drawing goes back to the window surface */
+    resizeWindow(a, a->m_windowWidth, a->m_windowHeight);
+    if(r->m_back)
+        SDL_FreeSurface(r->m_back);
+    r->m_back = NULL;
+
+    SDL_DestroySemaphore(r->m_wake);
+    SDL_DestroyMutex(r->m_frameLock);
+    r->m_wake = NULL;
+    r->m_frameLock = NULL;
+}
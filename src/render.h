@@ -0,0 +1,95 @@
+/*
+ * X-Tech Launcher - a simple template game launcher
+ *
+ * Copyright (c) 2009-2011 Andrew Spinks, original VB6 code
+ * Copyright (c) 2020-2020 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef RENDER_H
+#define RENDER_H
+
+#include <SDL2/SDL.h>
+
+#include "menu.h"
+
+typedef enum MenuInputType_t
+{
+    INPUT_MOTION = 0,
+    INPUT_CLICK,
+    INPUT_KEY,
+    INPUT_RESIZE,
+    INPUT_EXPOSE,
+    INPUT_QUIT
+} MenuInputType;
+
+/* Compact input record: position for mouse, scancode in x for keys, size for resize */
+typedef struct MenuInput_t
+{
+    int type;
+    int x;
+    int y;
+} MenuInput;
+
+/*
+ * Lock-free single-producer/single-consumer ring: the main thread pushes,
+ * the render thread pops. Each index is only written by its owner.
+ */
+typedef struct InputQueue_t
+{
+    MenuInput m_items[256];
+    SDL_atomic_t m_head;
+    SDL_atomic_t m_tail;
+} InputQueue;
+
+/*
+ * Render thread of the framebuffer mode: it composes the menu into its own
+ * back buffer while the main thread pumps events and runs menu actions.
+ * The render side keeps its own copy of the menu which replays the input
+ * for visuals only. SDL only allows window calls on the thread that made
+ * the window, so the main thread copies finished frames to the window
+ * surface and presents them.
+ */
+typedef struct RenderThread_t
+{
+    InputQueue m_queue;
+    SDL_sem *m_wake;
+    SDL_Thread *m_thread;
+    Menu m_menu;
+    App *m_app;
+
+    /* Guards the back buffer and the pending present */
+    SDL_mutex *m_frameLock;
+    SDL_Surface *m_back;
+    Uint32 m_presentEvent;
+    SDL_Rect m_presentRects[16];
+    int m_presentRectsCount;
+    SDL_bool m_presentFull;
+    SDL_bool m_presentPending;
+} RenderThread;
+
+extern int startRenderThread(RenderThread *r, Menu *m, App *a);
+extern void stopRenderThread(RenderThread *r);
+/* Called by the main thread only */
+extern void pushMenuInput(RenderThread *r, int type, int x, int y);
+/* Present a frame announced by the render thread, returns SDL_FALSE for other events */
+extern SDL_bool handleRenderEvent(RenderThread *r, const SDL_Event *e);
+
+#endif /* RENDER_H */
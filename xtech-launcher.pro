@@ -32,13 +32,40 @@ INCLUDEPATH += lib res
 
 win32: RC_FILE = res/nsmbx.rc
 
+# Image blobs are embedded into read-only data by the assembler,
+# run res/pack_res.sh to regenerate them from the BMP files
+RESOURCE_BLOBS = \
+    $$PWD/res/font2.blob \
+    $$PWD/res/back.blob \
+    $$PWD/res/splash.blob
+
+RESOURCE_ASM = res/resources.S
+
+res_embed.input = RESOURCE_ASM
+res_embed.output = ${QMAKE_FILE_BASE}$$first(QMAKE_EXT_OBJ)
+res_embed.commands = $$QMAKE_CC -c ${QMAKE_FILE_IN} -o ${QMAKE_FILE_OUT} -Wa,-I$$PWD/res
+res_embed.depends = $$RESOURCE_BLOBS
+res_embed.variable_out = OBJECTS
+QMAKE_EXTRA_COMPILERS += res_embed
+
 SOURCES += \
         lib/ini.c \
+        lib/lz4dec.c \
         src/app.c \
+        src/compose.c \
+        src/frame.c \
         src/main.c \
-        src/menu.c
+        src/menu.c \
+        src/pixops.c \
+        src/render.c
 
 HEADERS += \
     lib/ini.h \
+    lib/lz4dec.h \
+    res/resources.h \
     src/app.h \
-    src/menu.h
+    src/compose.h \
+    src/frame.h \
+    src/menu.h \
+    src/pixops.h \
+    src/render.h